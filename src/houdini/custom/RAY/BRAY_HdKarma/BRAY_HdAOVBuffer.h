@@ -80,9 +80,13 @@ public:
 
 private:
     void                _Deallocate() override final;
+    void		releaseTempbuf();
 
     BRAY::AOVBufferPtr		myAOVBuffer;
     UT_UniquePtr<uint8_t[]>	myTempbuf;
+    exint			myTempbufSize;
+    int				myTempMapCount;	// Outstanding temp mappings
+    int				myAOVMapCount;	// Outstanding BRAY mappings
     SYS_AtomicInt32		myConverged;
     int				myWidth, myHeight;
     HdFormat			myFormat;
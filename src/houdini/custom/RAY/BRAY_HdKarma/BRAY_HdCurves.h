@@ -72,6 +72,7 @@ private:
     BRAY::ObjectPtr	    myInstance;
     BRAY::ObjectPtr	    myMesh;
     UT_Array<GfMatrix4d>    myXform;
+    int			    myXformSamples;	// Samples provided by Hydra
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -28,6 +28,7 @@
 #include <pxr/base/gf/matrix4d.h>
 #include <pxr/imaging/hd/field.h>
 #include <GT/GT_Handles.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <UT/UT_Lock.h>
 #include <UT/UT_SmallArray.h>
 #include <UT/UT_StringHolder.h>
@@ -52,8 +53,15 @@ public:
 				     HdRenderParam* renderParam,
 				     HdDirtyBits* dirtyBits) override;
 
-    GT_PrimitiveHandle		getGTPrimitive() const
-				{ return myField; }
+    /// The field primitive is only loaded when it is first requested by a
+    /// volume, so fields that are never bound are never loaded.
+    GT_PrimitiveHandle		getGTPrimitive();
+
+    /// Changes whenever the field data changes, so volumes can tell which
+    /// of their fields need to be gathered again.  Versions are unique
+    /// across all fields.
+    int64			getVersion() const
+				{ return myVersion.relaxedLoad(); }
 
     const UT_StringHolder&	getFieldName() const
 				{ return myFieldName; };
@@ -84,7 +92,11 @@ private:
     UT_StringHolder		myFieldName;
     UT_SmallArray<GfMatrix4d>	myXfm;
     UT_StringSet		myVolumes;
+    UT_Lock			myFieldLock;
+    SYS_AtomicInt64		myVersion;
     int				myFieldIdx;
+    int				myXfmSamples;	// Samples provided by Hydra
+    bool			myFieldDirty;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
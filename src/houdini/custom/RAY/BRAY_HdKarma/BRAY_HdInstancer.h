@@ -93,6 +93,10 @@ public:
     /// from BRAY scenegraph.
     void	eraseFromScenegraph(BRAY::ScenePtr &scene);
 
+    /// Called when a prototype of this instancer is destroyed, to drop the
+    /// nested transforms cached for it.
+    void	removePrototype(const SdfPath &prototypeId);
+
     /// Returns nested level. For example, if this instancer does not have
     /// parent (ie root level) it will return 0. Also, if BRAY::Scene does not
     /// support nested instancing it will return 0.
@@ -113,6 +117,38 @@ private:
 
     BRAY::ObjectPtr	&findOrCreate(const SdfPath &path);
 
+    // The transforms computed for a prototype the last time it was nested.
+    // When a nested instancer is re-nested because one of its children
+    // changed, the transforms only need to be recomputed if this instancer's
+    // primvars, the prototype transform, the instance indices or the shutter
+    // changed.
+    struct NestedXforms
+    {
+	UT_Array<GfMatrix4d>		myProtoXform;
+	VtIntArray			myIndices;
+	UT_Array<BRAY::SpacePtr>	myXforms;
+	float				myShutter[2] = { 0, 0 };
+	exint				myVersion = -1;
+	int				mySegments = 0;
+    };
+    bool	findNestedXforms(const BRAY_HdParam &rparm,
+			const SdfPath &prototypeId,
+			const UT_Array<GfMatrix4d> &protoXform,
+			const VtIntArray &indices,
+			int nsegs,
+			UT_Array<BRAY::SpacePtr> &xforms) const;
+    void	storeNestedXforms(const BRAY_HdParam &rparm,
+			const SdfPath &prototypeId,
+			const UT_Array<GfMatrix4d> &protoXform,
+			const VtIntArray &indices,
+			int nsegs,
+			const UT_Array<BRAY::SpacePtr> &xforms);
+    void	updateNestedInstance(BRAY_HdParam &rparm,
+			BRAY::ScenePtr &scene,
+			const SdfPath &prototypeId,
+			const BRAY::ObjectPtr &protoObj,
+			const UT_Array<BRAY::SpacePtr> &xforms);
+
     void	applyNestedInstance(BRAY::ScenePtr &scene,
 			SdfPath const &prototypeId,
 			const BRAY::ObjectPtr &protoObj,
@@ -120,6 +156,7 @@ private:
 
 
     UT_Map<SdfPath, BRAY::ObjectPtr>	myInstanceMap;
+    UT_Map<SdfPath, NestedXforms>	myNestedXforms;
     BRAY::ObjectPtr			mySceneGraph;
     GT_AttributeListHandle		myAttributes;
     int					myNestLevel;
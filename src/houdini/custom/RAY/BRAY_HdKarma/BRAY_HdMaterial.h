@@ -25,12 +25,14 @@
 #ifndef __BRAY_HdMaterial__
 #define __BRAY_HdMaterial__
 
+#include "BRAY_HdParam.h"
 #include <pxr/pxr.h>
 #include <pxr/imaging/hd/material.h>
 #include <pxr/imaging/hd/enums.h>
 #include <pxr/base/gf/matrix4f.h>
 
 #include <UT/UT_StringArray.h>
+#include <SYS/SYS_Hash.h>
 
 class UT_JSONWriter;
 
@@ -43,6 +45,7 @@ public:
     ~BRAY_HdMaterial() override;
 
     void	Reload() override final;
+    void	Finalize(HdRenderParam *renderParam) override final;
     void	Sync(HdSceneDelegate *sceneDelegate,
 			HdRenderParam *renderParam,
 			HdDirtyBits *dirtyBits) override final;
@@ -64,6 +67,15 @@ private:
     UT_StringHolder	myDisplaceSource;
     UT_StringArray	mySurfaceParms;
     UT_StringArray	myDisplaceParms;
+
+    // Hash of the network structure (ignoring parameter values) from the
+    // last sync, used to detect parameter-only edits.
+    SYS_HashType	mySurfaceStructure;
+    SYS_HashType	myDisplaceStructure;
+
+    // The shared preview shader graphs held by this material
+    BRAY_HdParam::ShaderGraphRef	mySurfaceGraph;
+    BRAY_HdParam::ShaderGraphRef	myDisplaceGraph;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
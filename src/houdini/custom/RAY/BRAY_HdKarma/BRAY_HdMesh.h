@@ -73,6 +73,7 @@ private:
     BRAY::ObjectPtr		myInstance;
     BRAY::ObjectPtr		myMesh;
     UT_Array<GfMatrix4d>	myXform;
+    int				myXformSamples;	// Samples provided by Hydra
     int8			myRefineLevel;
     bool			myComputeN;
     bool			myLeftHanded;
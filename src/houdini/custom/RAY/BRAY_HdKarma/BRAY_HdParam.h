@@ -26,6 +26,7 @@
 #define __renderParam__
 
 #include <pxr/pxr.h>
+#include <pxr/imaging/hd/material.h>
 #include <pxr/imaging/hd/renderDelegate.h>
 #include <pxr/imaging/hd/renderThread.h>
 #include <SYS/SYS_AtomicInt.h>
@@ -78,6 +79,31 @@ public:
     bool	eraseLightCategory(const UT_StringHolder &name);
     bool	isValidLightCategory(const UT_StringHolder &name);
 
+    /// @{
+    /// Shader graphs converted from material networks are shared between
+    /// materials whose networks are identical.  The network should have its
+    /// paths made relative to the material, and the hash should be computed
+    /// from the relative network.  Each material holds a reference to the
+    /// graph it uses, and the graph is released when the last material
+    /// referencing it is re-synced with a different network or finalized.
+    struct ShaderGraphRef
+    {
+	SYS_HashType	myHash = 0;
+	bool		myValid = false;
+    };
+    bool	acquireShaderGraph(BRAY::ShaderGraphPtr &graph,
+			ShaderGraphRef &ref,
+			SYS_HashType hash,
+			const HdMaterialNetwork &net,
+			bool for_surface);
+    void	addShaderGraph(const BRAY::ShaderGraphPtr &graph,
+			ShaderGraphRef &ref,
+			SYS_HashType hash,
+			const HdMaterialNetwork &net,
+			bool for_surface);
+    void	releaseShaderGraph(ShaderGraphRef &ref, bool for_surface);
+    /// @}
+
     void	dump() const;
     void	dump(UT_JSONWriter &w) const;
 
@@ -159,6 +185,16 @@ private:
     exint	getQueueCount() const;
 
     using QueuedInstances = UT_Set<BRAY_HdInstancer *>;
+    struct SharedShaderGraph
+    {
+	HdMaterialNetwork	myNetwork;
+	BRAY::ShaderGraphPtr	myGraph;
+	int			myRefCount;
+    };
+    using SharedShaderGraphMap = UT_Map<SYS_HashType, SharedShaderGraph>;
+
+    SharedShaderGraphMap	 myShaderGraphs[2];	// Displace, surface
+    mutable UT_Lock		 myShaderGraphLock;
     UT_Array<QueuedInstances>    myQueuedInstancers;
     UT_StringHolder              myCameraPath;
     mutable                      UT_Lock myQueueLock;
@@ -82,11 +82,19 @@ protected:
 			HdDirtyBits *dirtyBits) override final;
 
 private:
-    /// Update method in spirit of the other HdRPrim update* methods
-    bool	updateProceduralPrims(const GT_AttributeListHandle& pointAttribs,
-				const GT_AttributeListHandle& detailAttribs,
-				UT_UniquePtr<BRAY_Procedural> &proc,
-				exint offset);
+    /// A procedural parameter value, stored as the element of the point or
+    /// detail attribute which provides the value.
+    struct ProceduralParam
+    {
+	UT_StringHolder		myName;
+	GT_DataArrayHandle	myData;
+	exint			myOffset;
+    };
+
+    /// Update method in spirit of the other HdRPrim update* methods.  All the
+    /// parameters for the procedural are passed in a single update.
+    bool	updateProceduralPrims(const UT_Array<ProceduralParam> &params,
+				UT_UniquePtr<BRAY_Procedural> &proc);
 
     /// Get the procedural 'type' primvar and create the procedural
     void	getUniqueProcedurals(const GT_AttributeListHandle& pointAttribs,
@@ -118,6 +126,7 @@ private:
     GT_AttributeListHandle  myAlist[2]; // store for procedurals
     bool		    myIsProcedural;
     UT_Array<GfMatrix4d>    myXform;
+    int			    myXformSamples;	// Samples provided by Hydra
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -290,11 +290,16 @@ public:
 
     /// Queries the scene delegate to check if we have animated transforms
     /// Note that this function does not query for instancer transforms yet!
+    /// The optional @c usdsamples should hold the number of samples Hydra
+    /// provided the last time the prim was sampled (or 0), and is updated
+    /// with the number of samples provided, so that prims with more samples
+    /// than segments can be sampled with a single query.
     static void		xformBlur(HdSceneDelegate* sceneDelegate,
 				const BRAY_HdParam &rparm,
 				const SdfPath &id,
 				UT_Array<GfMatrix4d>& xforms,
-				const BRAY::OptionSet &props);
+				const BRAY::OptionSet &props,
+				int *usdsamples = nullptr);
 
     /// Compute transformation blur by interpolating samples (if required).
     /// The @c times and @c nsegs are the sample times requested by the user
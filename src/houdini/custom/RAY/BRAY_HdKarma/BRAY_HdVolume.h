@@ -66,9 +66,22 @@ protected:
 	HdDirtyBits *dirtyBits) override final;
 
 private:
-    BRAY::ObjectPtr	    myInstance;
-    BRAY::ObjectPtr	    myVolume;
-    UT_Array<GfMatrix4d>    myXform;
+    /// Gather the fields bound to the volume, returning true if any of them
+    /// were added, removed or changed.
+    bool		updateFields(HdSceneDelegate *sceneDelegate);
+
+    struct FieldStamp
+    {
+	SdfPath	    myId;
+	int64	    myVersion;
+    };
+
+    BRAY::ObjectPtr		myInstance;
+    BRAY::ObjectPtr		myVolume;
+    BRAY::ObjectPtr::FieldList	myFields;
+    UT_Array<FieldStamp>	myFieldStamps;
+    UT_Array<GfMatrix4d>	myXform;
+    int				myXformSamples;	// Samples provided by Hydra
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -45,6 +45,7 @@
 #include <UT/UT_Lock.h>
 #include <UT/UT_ConcurrentHashMap.h>
 #include <UT/UT_ThreadSpecificValue.h>
+#include <UT/UT_RWLock.h>
 
 #include <pxr/pxr.h>
 #include <pxr/usd/ar/resolver.h>
@@ -79,6 +80,10 @@ public:
     // this function will return the expected path of temp file.
     std::string		 ComputeDiskPath(const std::string& path);
 
+    // Discard all disk paths cached outside of cache scopes. This is also
+    // done whenever a context is refreshed, and when the cache grows too big.
+    void		 ClearResolveCache();
+
     // ArResolver overrides
     void                 ConfigureResolverForAsset(
 				const std::string& path) override;
@@ -130,6 +135,8 @@ private:
     // Do the actual conversion of Houdini paths to real paths on disk.
     void		 _EvalHoudiniNoCache(const UT_String&,
 				UT_String& realPath);
+    void		 _EvalHoudiniCached(const UT_String& source,
+				UT_String& realPath);
     void		 _EvalHoudini(const UT_String& source,
 				UT_String& realPath);
 
@@ -160,6 +167,11 @@ private:
     typedef UT_Array<CacheScopeData>			 CacheScopeDataArray;
     typedef UT_ThreadSpecificValue<CacheScopeDataArray>	 TLSCacheScopeDataArray;
 
+    // Type for the identifier-to-diskPath cache that persists outside of
+    // cache scopes.
+    typedef UT_ConcurrentHashMap<UT_StringHolder, UT_StringHolder>
+							 ResolveCacheMap;
+
     // Types for thread-safe fetching
     struct FetchItem : public UT_IntrusiveRefCounter<FetchItem>
     {
@@ -178,6 +190,8 @@ private:
 
     // Private members
     TLSCacheScopeDataArray	 myTLSCacheScopeDataArray;
+    ResolveCacheMap		 myResolveCache;
+    UT_RWLock			 myResolveCacheLock;
     FetchMap			 myFetchMap;
     std::vector<std::string>	 mySearchPath;
     std::unique_ptr<ArResolver>	 myFallbackResolver;
@@ -52,6 +52,35 @@ VtMatrix4dArray GEOconvertXformArray(const GU_AgentRig &rig,
                                      const GU_Agent::Matrix4Array &agent_xforms,
                                      const UT_Array<exint> &joint_order);
 
+/// Identifies agent definitions that produce the same USD prims. Copies of a
+/// definition (e.g. from agents that were edited or loaded separately) that
+/// still share the same rig, shape library and layers, and that are
+/// translated with the same name and fallback bind pose, only need to be
+/// translated once.
+struct GEO_AgentDefinitionKey
+{
+    GEO_AgentDefinitionKey(
+        const GU_AgentDefinition &defn,
+        const UT_StringHolder &name,
+        const GU_Agent::Matrix4ArrayConstPtr &fallback_bind_pose);
+
+    bool operator==(const GEO_AgentDefinitionKey &other) const;
+
+    size_t hash() const;
+
+    /// For unordered_map.
+    friend size_t hash_value(const GEO_AgentDefinitionKey &key)
+    {
+        return key.hash();
+    }
+
+    const GU_AgentRig *myRig;
+    const GU_AgentShapeLib *myShapeLib;
+    UT_Array<const GU_AgentLayer *> myLayers;
+    UT_StringHolder myName;
+    GU_Agent::Matrix4ArrayConstPtr myFallbackBindPose;
+};
+
 /// Tracks information about the source agent shape when refining an entry in
 /// the shape library.
 struct GEO_AgentShapeInfo : public UT_IntrusiveRefCounter<GEO_AgentShapeInfo>
@@ -23,12 +23,14 @@
 #include <UT/UT_Map.h>
 #include <GT/GT_GEOPrimPacked.h>
 #include <GT/GT_Primitive.h>
+#include <GU/GU_DetailHandle.h>
 #include <SYS/SYS_Hash.h>
 #include BOOST_HEADER(variant.hpp)
 #include <pxr/pxr.h>
 #include <pxr/base/vt/types.h>
 #include <pxr/usd/sdf/path.h>
 
+class GU_Detail;
 class GU_PackedImpl;
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -66,6 +68,38 @@ struct GT_PackedFragmentId
     UT_StringHolder myAttribValue;
 };
 
+/// Identifies packed geometry by the contents of its embedded detail rather
+/// than by the detail's unique id, so that separate but identical copies of
+/// the same geometry (e.g. loaded from disk or unpacked multiple times) can
+/// share a single prototype. Keys with the same hash are compared against
+/// the contents of each other's detail, so a hash collision never matches
+/// different geometry.
+struct GT_PackedContentKey
+{
+    bool operator==(const GT_PackedContentKey &other) const;
+    size_t hash() const { return myHash; }
+
+    /// For unordered_map.
+    friend size_t hash_value(const GT_PackedContentKey &key)
+    {
+        return key.hash();
+    }
+
+    GU_ConstDetailHandle myDetail;
+    size_t myHash = 0;
+    exint myNumPoints = 0;
+    exint myNumVertices = 0;
+    exint myNumPrimitives = 0;
+};
+
+/// Computes the content key for the detail from its topology, public
+/// attribute values and groups. Returns false if the detail contains data
+/// that isn't covered by the key (e.g. primitive types other than polygons,
+/// or array attributes), in which case the geometry can only be identified
+/// by its unique id.
+bool GTcomputePackedContentKey(const GU_ConstDetailHandle &gdh,
+                               GT_PackedContentKey &key);
+
 using GT_PackedGeometryId = exint;
 using GT_PackedDiskId = UT_StringHolder;
 
@@ -97,12 +131,12 @@ public:
     void setPath(const GEO_PathHandle &path) { myPath = path; }
     /// @}
 
-    /// Returns the packed prims's prototype index, or -1 if it has not been
-    /// registered.
-    int findPrototype(const GT_GEOPrimPacked &prototype_prim) const;
-    /// Registers a prototype with the given packed primitive. Typically this
-    /// will be a child of the instancer prim.
-    int addPrototype(const GT_GEOPrimPacked &prototype_prim,
+    /// Returns the prototype index for the packed prim's instance key, or -1
+    /// if it has not been registered.
+    int findPrototype(const GT_PackedInstanceKey &key) const;
+    /// Registers a prototype with the given packed primitive's instance key.
+    /// Typically this will be a child of the instancer prim.
+    int addPrototype(const GT_PackedInstanceKey &key,
                      const GEO_PathHandle &path);
     /// Returns the list of prototypes.
     SdfPathVector getPrototypePaths() const;
@@ -37,6 +37,7 @@ class TfToken;
 class SdfPath;
 struct GEO_AgentShapeInfo;
 class GEO_FilePrim;
+class GEO_FilePropSourceCache;
 
 class GEO_ImportOptions
 {
@@ -86,6 +87,8 @@ public:
     bool                         myTranslateUVToST = true;
     bool                         mySetDefaultPrim = true;
     bool                         myHeightfieldConvert = false;
+    // Optional cache for sharing attribute sources between properties.
+    GEO_FilePropSourceCache	*myPropSourceCache = nullptr;
 };
 
 void 
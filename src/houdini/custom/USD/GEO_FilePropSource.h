@@ -21,9 +21,13 @@
 #include "GEO_FileFieldValue.h"
 #include <GT/GT_DataArray.h>
 #include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_Map.h>
 #include <UT/UT_NonCopyable.h>
 #include <UT/UT_TBBSpinLock.h>
+#include <SYS/SYS_Hash.h>
+#include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <typeindex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -255,6 +259,97 @@ private:
     VtArray<T>		 myValue;
 };
 
+// Shares the attribute sources created from identical attribute arrays, so
+// that the data is only converted once no matter how many properties
+// (possibly on different refined primitives, each with its own GT arrays) are
+// authored from it.
+class GEO_FilePropSourceCache : public UT_NonCopyable
+{
+public:
+    // Returns the source of type SourceT for the attribute array, creating it
+    // if no array with the same values and layout has been authored to the
+    // same property name before. Data ids are not used to identify arrays,
+    // since sub-ranges and derived arrays carry the id of the whole source
+    // attribute, so arrays are matched by hashing their values and then
+    // comparing them in full.
+    template <typename SourceT>
+    GEO_FilePropSource	*findOrCreate(const GT_DataArrayHandle &attrib,
+				const TfToken &name)
+			 {
+			    Key key;
+			    key.myHash = attrib->hashRange(0, attrib->entries());
+			    key.myEntries = attrib->entries();
+			    key.myName = name;
+			    key.myType = std::type_index(typeid(SourceT));
+			    key.myTupleSize = attrib->getTupleSize();
+			    key.myStorage = attrib->getStorage();
+			    key.myTypeInfo = attrib->getTypeInfo();
+
+			    UT_Array<Entry> &entries = mySources[key];
+			    for (const Entry &entry : entries)
+			    {
+				if (entry.myAttrib->isEqual(*attrib))
+				{
+				    ++myNumShared;
+				    return entry.mySource.get();
+				}
+			    }
+
+			    GEO_FilePropSource *source = new SourceT(attrib);
+			    entries.append({ attrib, source });
+			    return source;
+			 }
+
+    // The number of properties that re-used an existing source.
+    exint		 numShared() const
+			 { return myNumShared; }
+
+private:
+    struct Key
+    {
+	bool operator==(const Key &other) const
+	{
+	    return myHash == other.myHash &&
+		   myEntries == other.myEntries &&
+		   myName == other.myName &&
+		   myType == other.myType &&
+		   myTupleSize == other.myTupleSize &&
+		   myStorage == other.myStorage &&
+		   myTypeInfo == other.myTypeInfo;
+	}
+
+	friend size_t hash_value(const Key &key)
+	{
+	    size_t hash = key.myHash;
+	    SYShashCombine(hash, key.myEntries);
+	    SYShashCombine(hash, key.myName.Hash());
+	    SYShashCombine(hash, key.myType.hash_code());
+	    SYShashCombine(hash, key.myTupleSize);
+	    SYShashCombine(hash, int(key.myStorage));
+	    SYShashCombine(hash, int(key.myTypeInfo));
+	    return hash;
+	}
+
+	SYS_HashType		 myHash = 0;
+	GT_Size			 myEntries = 0;
+	TfToken			 myName;
+	std::type_index		 myType = std::type_index(typeid(void));
+	int			 myTupleSize = 0;
+	GT_Storage		 myStorage = GT_STORE_INVALID;
+	GT_Type			 myTypeInfo = GT_TYPE_NONE;
+    };
+
+    // The array is kept so that later arrays with the same hash can be
+    // compared against it.
+    struct Entry
+    {
+	GT_DataArrayHandle		 myAttrib;
+	GEO_FilePropSourceHandle	 mySource;
+    };
+
+    UT_Map<Key, UT_Array<Entry>>	 mySources;
+    exint				 myNumShared = 0;
+};
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
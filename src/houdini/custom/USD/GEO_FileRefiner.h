@@ -150,12 +150,19 @@ private:
     // modifying to be a valid Usd prim path.
     std::string createPrimPath( const std::string& primName);
 
+    /// Create a new refiner with the same settings, which accumulates its
+    /// prims in a different collector. Used for refining a partition of the
+    /// current detail.
+    GEO_FileRefiner createPartitionRefiner(GEO_FileRefinerCollector &collector);
+
     /// Create a new refiner and copy any settings that should be propagated to
-    /// a sub-refiner.
+    /// a sub-refiner. The sub-refiner adds its prims to this refiner's
+    /// collector, unless a different collector is given.
     GEO_FileRefiner createSubRefiner(
         const SdfPath &pathPrefix, const UT_StringArray &pathAttrNames,
         const GT_PrimitiveHandle &src_prim,
-        const GEO_AgentShapeInfo &agentShapeInfo = GEO_AgentShapeInfo());
+        const GEO_AgentShapeInfo &agentShapeInfo = GEO_AgentShapeInfo(),
+        GEO_FileRefinerCollector *collector = nullptr);
 
     /// Creates or returns the point instancer for the given primitive path.
     UT_IntrusivePtr<GT_PrimPointInstancer>
@@ -215,6 +222,10 @@ private:
     // The known agent definitions and their prim paths
     UT_Map<GU_AgentDefinitionConstPtr, SdfPath> m_knownAgentDefs;
 
+    // Prim paths for the known agent definitions by their contents, so that
+    // copies of a definition share the same prims.
+    UT_Map<GEO_AgentDefinitionKey, SdfPath> m_knownAgentDefContents;
+
     // Map from a packed primitive to the path where it was unpacked. Used for
     // converting packed primitives to native instances.
     UT_Map<GT_PackedInstanceKey, GEO_PathHandle> m_knownInstancedGeos;
@@ -258,6 +269,15 @@ public:
     // Complete any final work after refining all prims.
     void finish( GEO_FileRefiner& refiner );
 
+    // Adds the prims that were deferred by another collector, in the order
+    // they were added to it.
+    void replay( const GEO_FileRefinerCollector& deferred );
+
+    // Returns the instance key for a packed primitive. Packed geometry with
+    // identical contents (but different details) is given the same key so
+    // that a single prototype is shared between all copies.
+    GT_PackedInstanceKey instanceKey(const GT_GEOPrimPacked &gtpacked);
+
     ////////////////////////////////////////////////////////////////////////////
 
     // The results of the refine
@@ -265,6 +285,32 @@ public:
 
     // Map used to generate unique names for each prim
     std::map<SdfPath, NameInfo> m_names;
+
+    // When set, add() only records its arguments so that the prims can be
+    // added to another collector later with replay(). This allows partitions
+    // to be refined in parallel while still generating the same names as a
+    // serial refine.
+    bool m_deferAdds = false;
+
+    struct DeferredAdd {
+        SdfPath             path;
+        bool                addNumericSuffix;
+        GT_PrimitiveHandle  prim;
+        UT_Matrix4D         xform;
+        GA_DataId           topologyId;
+        TfToken             purpose;
+        GusdWriteCtrlFlags  writeCtrlFlags;
+        GEO_AgentShapeInfo  agentShapeInfo;
+    };
+    UT_Array<DeferredAdd> m_deferredAdds;
+
+    // Maps each packed detail's unique id to the unique id of the first
+    // detail found with the same contents.
+    UT_Map<exint, exint> m_canonicalGeometryIds;
+    UT_Map<GT_PackedContentKey, exint> m_contentGeometryIds;
+
+    // The number of packed details that were replaced by an identical detail.
+    exint m_numDedupedGeometries = 0;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
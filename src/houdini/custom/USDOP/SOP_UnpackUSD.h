@@ -52,12 +52,17 @@ protected:
 
     OP_ERROR            _Cook(OP_Context& ctx);
 
+    /** Traverse beneath all of the root @a prims in a single parallel pass.
+        Roots sharing the same prim, time and purposes are only traversed
+        once. If @a toGprims is true, the prims found by @a traversal are
+        traversed further down to gprims within the same pass.*/
     bool _Traverse(const UT_String& traversal,
                    const fpreal time,
                    const UT_Array<UsdPrim>& prims,
                    const GusdDefaultArray<UsdTimeCode>& times,
                    const GusdDefaultArray<GusdPurposeSet>& purposes,
                    bool skipRoot,
+                   bool toGprims,
                    UT_Array<GusdUSD_Traverse::PrimIndexPair>& traversed);
 
 
@@ -3,6 +3,7 @@ add_definitions( -DUSDHOUDINI_EXPORTS -DUSDMANTRA_EXPORTS )
 set( husd_sources
     HUSD_Asset.C
     HUSD_AssetPath.C
+    HUSD_AutoDrawMode.C
     HUSD_BindMaterial.C
     HUSD_Blend.C
     HUSD_ChangeBlock.C
@@ -46,6 +47,7 @@ set( husd_sources
     HUSD_HydraPrim.C
     HUSD_Imaging.C
     HUSD_Info.C
+    HUSD_InstanceIdRanges.C
     HUSD_KarmaShaderTranslator.C
     HUSD_LayerCheckpoint.C
     HUSD_LayerOffset.C
@@ -107,6 +109,7 @@ set( husd_sources
     XUSD_Ticket.C
     XUSD_TicketRegistry.C
     XUSD_Tokens.C
+    XUSD_TraceRecorder.C
     XUSD_Utils.C
 
     UsdHoudini/houdiniFieldAsset.cpp
@@ -119,6 +122,7 @@ set( husd_hdk_headers
     HUSD_API.h
     HUSD_Asset.h
     HUSD_AssetPath.h
+    HUSD_AutoDrawMode.h
     HUSD_BindMaterial.h
     HUSD_Blend.h
     HUSD_Bucket.h
@@ -158,6 +162,7 @@ set( husd_hdk_headers
     HUSD_GetMetadata.h
     HUSD_Imaging.h
     HUSD_Info.h
+    HUSD_InstanceIdRanges.h
     HUSD_KarmaShaderTranslator.h
     HUSD_LayerCheckpoint.h
     HUSD_LayerOffset.h
@@ -217,6 +222,7 @@ set( husd_hdk_headers
     XUSD_Ticket.h
     XUSD_TicketRegistry.h
     XUSD_Tokens.h
+    XUSD_TraceRecorder.h
     XUSD_Utils.h
 )
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __HUSD_AutoDrawMode_h__
+#define __HUSD_AutoDrawMode_h__
+
+#include "HUSD_API.h"
+#include "HUSD_DataHandle.h"
+#include <UT/UT_Matrix4.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_Options.h>
+#include <UT/UT_Rect.h>
+#include <UT/UT_UniquePtr.h>
+
+class HUSD_MirrorRootLayer;
+class HUSD_TimeCode;
+
+// Automatically switches models to the "cards" or "bounds" draw mode based
+// on their projected size in the viewport. The chosen draw modes are authored
+// into the transient root layer of the mirrored viewport stage, so they never
+// reach any saved data, and only the models whose draw mode actually changes
+// get repopulated in Hydra. Models with an authored draw mode are left alone,
+// and the draw mode overrides set by the user are stronger than the
+// automatic ones.
+class HUSD_API HUSD_AutoDrawMode : public UT_NonCopyable
+{
+public:
+				 HUSD_AutoDrawMode();
+				~HUSD_AutoDrawMode();
+
+    enum Level
+    {
+	LEVEL_FULL,
+	LEVEL_CARDS,
+	LEVEL_BOUNDS,
+	NUM_LEVELS
+    };
+
+    // Models smaller than these sizes (in pixels, along the larger screen
+    // axis of their projected bounds) are drawn as cards or bounds. Models
+    // without any card textures use bounds in place of cards. To avoid
+    // flickering between levels, a model only returns to a more detailed
+    // level once it grows past the threshold scaled by (1 + hysteresis).
+    void			 setThresholds(fpreal cards_size,
+					fpreal bounds_size,
+					fpreal hysteresis = 0.25);
+    fpreal			 cardsSize() const
+				 { return myCardsSize; }
+    fpreal			 boundsSize() const
+				 { return myBoundsSize; }
+    fpreal			 hysteresis() const
+				 { return myHysteresis; }
+
+    // Compute the level of every model on the stage being mirrored as seen
+    // through the given view, and update the automatic draw modes in the
+    // mirror root layer for the models whose level changed. Returns true if
+    // the root layer was modified, in which case it has to be pushed to the
+    // mirrored stage with HUSD_DataHandle::mirrorUpdateRootLayer().
+    bool			 update(const HUSD_DataHandle &data,
+					HUSD_MirrorRootLayer &rootlayer,
+					const HUSD_TimeCode &timecode,
+					const UT_Matrix4D &view_matrix,
+					const UT_Matrix4D &proj_matrix,
+					const UT_DimRect &viewport_rect);
+    // Remove all automatic draw modes and forget all cached data.
+    void			 clear(HUSD_MirrorRootLayer &rootlayer);
+
+    // The number of models drawn at each level by the last update(), and the
+    // number of models whose draw mode changed during that update.
+    exint			 modelCount(Level level) const
+				 { return myModelCounts[level]; }
+    exint			 changedCount() const
+				 { return myChangedCount; }
+    // Add the counts above to a set of render statistics.
+    void			 getStats(UT_Options &stats) const;
+
+private:
+    class husd_AutoDrawModePrivate;
+
+    UT_UniquePtr<husd_AutoDrawModePrivate>	 myPrivate;
+    fpreal					 myCardsSize;
+    fpreal					 myBoundsSize;
+    fpreal					 myHysteresis;
+    exint					 myModelCounts[NUM_LEVELS];
+    exint					 myChangedCount;
+};
+
+#endif
@@ -27,6 +27,7 @@
 
 #include "HUSD_API.h"
 #include "HUSD_DataHandle.h"
+#include "HUSD_InstanceIdRanges.h"
 #include "HUSD_Utils.h"
 #include <UT/UT_IntArray.h>
 #include <UT/UT_StringHolder.h>
@@ -52,6 +53,12 @@ public:
 				 { return myPrimPath; }
     void			 setPrimPath(const UT_StringHolder &primpath);
 
+    /// Returns the matched instance ids as ranges, which is much more
+    /// compact than a list of ids for large selections.
+    const HUSD_InstanceIdRanges	&getInstanceIdRanges(
+					const HUSD_TimeCode &tc) const;
+    /// Returns the matched instance ids as a list. This is expanded from
+    /// the ranges the first time it is requested.
     const UT_IntArray		&getInstanceIds(const HUSD_TimeCode &tc) const;
 
 private:
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+#ifndef __HUSD_InstanceIdRanges_h__
+#define __HUSD_InstanceIdRanges_h__
+
+#include "HUSD_API.h"
+#include <UT/UT_Array.h>
+#include <UT/UT_IntArray.h>
+#include <UT/UT_StringHolder.h>
+#include <SYS/SYS_Types.h>
+
+/// A set of instance ids stored as sorted, disjoint ranges. Large
+/// selections (such as half of the instances of a point instancer) cost
+/// memory proportional to the number of ranges rather than the number of
+/// ids. Adding or removing ids in ascending order, as happens when
+/// expanding a pattern, only ever touches the last few ranges.
+class HUSD_API HUSD_InstanceIdRanges
+{
+public:
+    /// A range of ids from myStart up to, but not including, myEnd.
+    struct Range
+    {
+	exint		 myStart;
+	exint		 myEnd;
+    };
+
+			 HUSD_InstanceIdRanges()
+			 { }
+
+    void		 clear()
+			 { myRanges.clear(); }
+    bool		 isEmpty() const
+			 { return myRanges.isEmpty(); }
+    /// Number of ids in the set.
+    exint		 entries() const;
+
+    const UT_Array<Range>	&ranges() const
+			 { return myRanges; }
+
+    bool		 contains(exint id) const;
+
+    void		 add(exint id)
+			 { addRange(id, id+1); }
+    void		 addRange(exint start, exint end);
+    void		 remove(exint id)
+			 { removeRange(id, id+1); }
+    void		 removeRange(exint start, exint end);
+
+    /// Replaces the contents of the set with the provided ids, which may be
+    /// in any order and may contain duplicates.
+    void		 setIds(const int *ids, exint n);
+
+    /// Appends all the ids in the set to the array in ascending order.
+    void		 getIds(UT_IntArray &ids) const;
+
+    /// Returns the set as a numeric pattern (such as "0-9 12 20-39") that
+    /// can be parsed back by HUSD_FindInstanceIds.
+    UT_StringHolder	 getPattern() const;
+
+    bool		 operator==(const HUSD_InstanceIdRanges &other) const;
+    bool		 operator!=(const HUSD_InstanceIdRanges &other) const
+			 { return !(*this == other); }
+
+private:
+    /// Index of the first range that ends at or after id, which is the
+    /// first range that id could be added to.
+    exint		 findRange(exint id) const;
+
+    UT_Array<Range>	 myRanges;
+};
+
+#endif
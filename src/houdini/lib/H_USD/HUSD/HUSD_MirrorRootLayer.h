@@ -28,6 +28,7 @@
 #include "HUSD_API.h"
 #include <UT/UT_Matrix4.h>
 #include <UT/UT_StringHolder.h>
+#include <UT/UT_StringMap.h>
 #include <UT/UT_UniquePtr.h>
 #include <pxr/pxr.h>
 
@@ -44,9 +45,11 @@ PXR_NAMESPACE_CLOSE_SCOPE
 // overridden by the data in the HUSD_Overrides, so we put it into the root
 // layer of the mirrored stage.
 //
-// For now this root layer holds the USD camera primitive used when free
-// tumbling in the viewport. This camera can either be a default camera or
-// a reference to an existing camera, with modifications to the transforms.
+// This root layer holds the USD camera primitive used when free tumbling in
+// the viewport. This camera can either be a default camera or a reference to
+// an existing camera, with modifications to the transforms. It also holds the
+// draw modes picked automatically for models based on their size on screen
+// (see HUSD_AutoDrawMode).
 class HUSD_API HUSD_MirrorRootLayer
 {
 public:
@@ -76,6 +79,15 @@ public:
                                         const UT_StringRef &refcamera,
                                         const CameraParms &camparms);
 
+    // Set or clear (with an empty string) the automatic draw mode of each
+    // model primitive in the map. Paths not in the map are left unchanged.
+    // Returns true if the layer was modified.
+    bool                         setAutoDrawModes(
+                                        const UT_StringMap<UT_StringHolder>
+                                            &drawmodes);
+    // Remove all automatic draw modes from this layer.
+    void                         clearAutoDrawModes();
+
 private:
     UT_UniquePtr<PXR_NS::XUSD_MirrorRootLayerData>	 myData;
 };
@@ -223,6 +223,9 @@ protected:
     UT_SmallArray<float>       	myXTimes;	// USD time samples for xforms
     UT_SmallArray<float>	myPTimes;	// USD time samples for primvars
     UT_SmallArray<GfMatrix4d>	myXforms;	// Transform matrices
+    // Incremented each time syncPrimvars() pulls new transforms or primvars,
+    // so that values derived from them can be cached.
+    exint			myPrimvarVersion;
 
     mutable UT_Lock myLock;
 
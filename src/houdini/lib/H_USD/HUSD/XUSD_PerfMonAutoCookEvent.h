@@ -26,6 +26,7 @@
 #define __XUSD_PerfMonAutoCookEvent_h__
 
 #include "HUSD_API.h"
+#include "XUSD_TraceRecorder.h"
 #include <OP/OP_Node.h>
 #include <UT/UT_PerfMonAutoEvent.h>
 #include <pxr/pxr.h>
@@ -36,6 +37,7 @@ class XUSD_PerfMonAutoCookEvent : public UT_PerfMonAutoEvent
 {
 public:
     XUSD_PerfMonAutoCookEvent(int nodeid, const char *msg)
+        : myTraceEvent(msg, "husd", nodeid)
     {
         UT_Performance      *perfmon = UTgetPerformance();
 
@@ -49,6 +51,10 @@ public:
     }
     ~XUSD_PerfMonAutoCookEvent()
     { }
+
+private:
+    // Also record the event for batch tracing.
+    XUSD_AutoTraceEvent  myTraceEvent;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_TraceRecorder_h__
+#define __XUSD_TraceRecorder_h__
+
+#include "HUSD_API.h"
+#include <UT/UT_StringHolder.h>
+#include <SYS/SYS_Types.h>
+#include <pxr/pxr.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Records timed events and writes them as a Chrome trace (which can be
+/// loaded in chrome://tracing or Perfetto). Unlike the performance monitor,
+/// this works in batch and headless sessions. Recording is enabled by
+/// setting HOUDINI_USD_TRACE_FILE to the path of the trace file, which is
+/// written when the process exits. When recording is disabled, timing an
+/// event costs a single flag test.
+class HUSD_API XUSD_TraceRecorder
+{
+public:
+    /// Returns true if events are being recorded.
+    static bool		 isRecording();
+
+    /// Microseconds since the recorder was started.
+    static int64	 currentTime();
+
+    /// Adds a completed event to the calling thread's event list. The
+    /// @c name and @c category must be string literals. Each thread keeps
+    /// at most HOUDINI_USD_TRACE_MAX_EVENTS events (one million by default);
+    /// later events are dropped and counted in the trace.
+    static void		 recordEvent(const char *name,
+				const char *category,
+				const UT_StringHolder &detail,
+				int64 start_time,
+				int64 end_time);
+
+    /// Writes all events recorded so far to the trace file. Recording is
+    /// paused while the file is written, and events completed by other
+    /// threads in the meantime are dropped.
+    static bool		 writeTrace();
+
+    /// Returns the full path of the node, for use as an event detail.
+    static UT_StringHolder nodePath(int nodeid);
+};
+
+/// Records an event spanning the lifetime of this object.
+class HUSD_API XUSD_AutoTraceEvent
+{
+public:
+    XUSD_AutoTraceEvent(const char *name,
+	    const char *category,
+	    const char *detail = nullptr)
+	: myName(nullptr)
+    {
+	if (XUSD_TraceRecorder::isRecording())
+	{
+	    myName = name;
+	    myCategory = category;
+	    if (detail)
+		myDetail = detail;
+	    myStartTime = XUSD_TraceRecorder::currentTime();
+	}
+    }
+    XUSD_AutoTraceEvent(const char *name,
+	    const char *category,
+	    int nodeid)
+	: myName(nullptr)
+    {
+	if (XUSD_TraceRecorder::isRecording())
+	{
+	    myName = name;
+	    myCategory = category;
+	    myDetail = XUSD_TraceRecorder::nodePath(nodeid);
+	    myStartTime = XUSD_TraceRecorder::currentTime();
+	}
+    }
+    ~XUSD_AutoTraceEvent()
+    {
+	if (myName)
+	    XUSD_TraceRecorder::recordEvent(myName, myCategory, myDetail,
+		myStartTime, XUSD_TraceRecorder::currentTime());
+    }
+
+private:
+    const char		*myName;
+    const char		*myCategory;
+    UT_StringHolder	 myDetail;
+    int64		 myStartTime;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
+
@@ -38,6 +38,7 @@ set( gusd_sources
     USD_StdTraverse.cpp
     USD_ThreadedTraverse.cpp
     USD_Traverse.cpp
+    USD_TraverseCache.cpp
     USD_Utils.cpp
     USD_VisCache.cpp
     USD_XformCache.cpp
@@ -94,6 +95,7 @@ set( gusd_hdk_headers
     USD_StdTraverse.h
     USD_ThreadedTraverse.h
     USD_Traverse.h
+    USD_TraverseCache.h
     USD_TraverseSimple.h
     USD_Utils.h
     USD_VisCache.h
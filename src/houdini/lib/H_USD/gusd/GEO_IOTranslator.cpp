@@ -38,6 +38,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 using std::cerr;
 using std::endl;
 
+GusdDetailLayerConverter GusdGEO_IOTranslator::theDetailLayerConverter = nullptr;
+
 //##############################################################################
 // class GusdGEO_IOTranslator implementation
 //##############################################################################
@@ -131,9 +133,49 @@ fileLoad(GEO_Detail* gdp, UT_IStream& is, bool ate_magic)
 
 
 GA_Detail::IOStatus GusdGEO_IOTranslator::
-fileSave(const GEO_Detail*, std::ostream&)
+fileSave(const GEO_Detail* gdp, std::ostream& os)
 {
-    return 0;
+    const GU_Detail* detail = dynamic_cast<const GU_Detail *>(gdp);
+    if( !detail || !theDetailLayerConverter ) {
+        return GA_Detail::IOStatus( false );
+    }
+
+    SdfLayerRefPtr layer = theDetailLayerConverter(*detail);
+    std::string str;
+    if( !layer || !layer->ExportToString(&str) ) {
+        return GA_Detail::IOStatus( false );
+    }
+
+    os << str;
+    return GA_Detail::IOStatus( !os.fail() );
+}
+
+
+GA_Detail::IOStatus GusdGEO_IOTranslator::
+fileSaveToFile(const GEO_Detail* gdp, const char* fileName)
+{
+    const GU_Detail* detail = dynamic_cast<const GU_Detail *>(gdp);
+    if( !detail || !fileName || !theDetailLayerConverter ) {
+        return GA_Detail::IOStatus( false );
+    }
+
+    // The converted layer is backed directly by the detail, so exporting it
+    // writes the attribute arrays straight into the output file.
+    SdfLayerRefPtr layer = theDetailLayerConverter(*detail);
+    if( !layer ) {
+        return GA_Detail::IOStatus( false );
+    }
+
+    return GA_Detail::IOStatus( layer->Export(fileName) );
+}
+
+
+void GusdGEO_IOTranslator::
+SetDetailLayerConverter(GusdDetailLayerConverter converter)
+{
+    // This callback should only be set once.
+    UT_ASSERT(!theDetailLayerConverter);
+    theDetailLayerConverter = converter;
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
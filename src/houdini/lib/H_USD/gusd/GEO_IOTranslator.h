@@ -24,14 +24,22 @@
 #ifndef __GUSD_IOTRANSLATOR_H__
 #define __GUSD_IOTRANSLATOR_H__
 
+#include "gusd/api.h"
+
 #include "pxr/pxr.h"
+#include "pxr/usd/sdf/layer.h"
 
 #include <GEO/GEO_IOTranslator.h>
 
 #include <iostream>
 
+class GU_Detail;
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// Converts a detail to a layer, without composing a stage.
+typedef SdfLayerRefPtr (*GusdDetailLayerConverter)(const GU_Detail &gdp);
+
 class GusdGEO_IOTranslator : public GEO_IOTranslator
 {
 public:
@@ -51,9 +59,23 @@ public:
 
     GA_Detail::IOStatus fileLoad(GEO_Detail*, UT_IStream&, bool ate_magic) override;
 
+    /// Writes usda text, since crate files can only be written to disk.
     GA_Detail::IOStatus fileSave(const GEO_Detail*, std::ostream&) override;
+
+    /// Writes the format implied by the file extension.
+    GA_Detail::IOStatus fileSaveToFile(const GEO_Detail*,
+                                       const char* fileName) override;
     
     // -------------------------------------------------------------------------
+
+    /// Set the callback used to convert a detail to a layer when saving.
+    /// This lives in the HUSD library, which owns the bgeo to USD
+    /// translation. Without it, saving always fails.
+    GUSD_API
+    static void SetDetailLayerConverter(GusdDetailLayerConverter converter);
+
+private:
+    static GusdDetailLayerConverter theDetailLayerConverter;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -58,6 +58,7 @@
 #include <OP/OP_Director.h>
 #include <CH/CH_Manager.h>
 #include <GA/GA_AttributeFilter.h>
+#include <GA/GA_Topology.h>
 #include <GA/GA_SaveMap.h>
 #include <GT/GT_PrimInstance.h>
 #include <GT/GT_GEODetail.h>
@@ -73,6 +74,7 @@
 #include <GU/GU_PrimPacked.h>
 #include <UT/UT_DMatrix4.h>
 #include <UT/UT_Map.h>
+#include <UT/UT_ParallelUtil.h>
 #include <SYS/SYS_TypeTraits.h>
 
 #include <mutex>
@@ -299,6 +301,153 @@ GusdGU_PackedUSD::Build(
     return packedPrim;
 }
 
+/* static */
+exint
+GusdGU_PackedUSD::BuildInstances(
+    GU_Detail&              detail,
+    const UT_StringHolder&  fileName,
+    const SdfPathVector&    protoPaths,
+    const SdfPath&          srcPrimPath,
+    const VtArray<int>&     protoIndices,
+    const VtArray<GfMatrix4d>& instanceXforms,
+    const UT_Matrix4D&      xform,
+    UsdTimeCode             frame,
+    const char*             lod,
+    GusdPurposeSet          purposes)
+{
+    UT_ASSERT(protoIndices.size() == instanceXforms.size());
+
+    // Find the instances to build, and which prototypes they use.
+    UT_Array<exint> instances;
+    UT_Array<bool> protoUsed;
+    instances.setCapacity(protoIndices.size());
+    protoUsed.appendMultiple(false, protoPaths.size());
+    for( exint i = 0, n = protoIndices.size(); i < n; ++i )
+    {
+        const int idx = protoIndices[i];
+        if( idx < 0 || idx >= protoPaths.size() )
+        {
+            TF_WARN( "Invalid prototype index: %d", idx );
+            continue;
+        }
+        instances.append(i);
+        protoUsed(idx) = true;
+    }
+
+    const exint ninstances = instances.size();
+    if( ninstances == 0 )
+        return 0;
+
+    // Resolve each prototype prim and its USD transform once, rather than
+    // once per instance.
+    UT_Array<UsdPrim> protoPrims;
+    UT_Array<UT_Matrix4D> protoXforms;
+    UT_Array<UT_Matrix4D> protoInvXforms;
+    protoPrims.setSize(protoPaths.size());
+    protoXforms.setSize(protoPaths.size());
+    protoInvXforms.setSize(protoPaths.size());
+    {
+        GusdStageCacheReader cache;
+        for( exint i = 0, n = protoPaths.size(); i < n; ++i )
+        {
+            protoXforms(i).identity();
+            protoInvXforms(i).identity();
+            if( !protoUsed(i) )
+                continue;
+
+            SdfPath primPathWithoutVariants;
+            GusdStageEditPtr edit;
+            GusdStageEdit::GetPrimPathAndEditFromVariantsPath(
+                protoPaths[i], primPathWithoutVariants, edit);
+            protoPrims(i) = cache.GetPrim(fileName, primPathWithoutVariants,
+                                          edit, GusdStageOpts::LoadAll()).first;
+
+            if( !protoPrims(i) )
+                TF_WARN( "Invalid prim! %s", protoPaths[i].GetText() );
+            else if( protoPrims(i).IsA<UsdGeomXformable>() )
+            {
+                GusdUSD_XformCache::GetInstance().GetLocalToWorldTransform(
+                    protoPrims(i), frame, protoXforms(i) );
+                protoInvXforms(i) = protoXforms(i);
+                protoInvXforms(i).invert();
+            }
+        }
+    }
+
+    // Allocate all of the primitives, vertices and points in blocks.
+    GA_Offset vtxoff;
+    const GA_Offset primoff = detail.appendPrimitivesAndVertices(
+        typeId(), ninstances, 1, vtxoff, true);
+    const GA_Offset ptoff = detail.appendPointBlock(ninstances);
+    GA_Topology &topology = detail.getTopology();
+    for( exint i = 0; i < ninstances; ++i )
+        topology.wireVertexPoint(vtxoff + i, ptoff + i);
+
+    // Make sure that writing P for different points from different threads
+    // never has to harden a shared page.
+    detail.getP()->hardenAllPages();
+
+    GEO_ViewportLOD viewportLod = GEO_VIEWPORT_FULL;
+    if( lod )
+        viewportLod = GEOviewportLOD(lod);
+
+    UTparallelForLightItems(UT_BlockedRange<exint>(0, ninstances),
+        [&](const UT_BlockedRange<exint> &r)
+        {
+            for( exint i = r.begin(), n = r.end(); i < n; ++i )
+            {
+                const exint inst = instances(i);
+                const int idx = protoIndices[inst];
+                auto packedPrim = UTverify_cast<GU_PrimPacked *>(
+                    detail.getPrimitive(primoff + i));
+                auto impl = UTverify_cast<GusdGU_PackedUSD *>(
+                    packedPrim->hardenImplementation());
+
+                // Strings and paths are shared with the prototype.
+                impl->m_fileName = fileName;
+                impl->m_primPath = protoPaths[idx];
+                impl->m_srcPrimPath = srcPrimPath;
+                impl->m_index = inst;
+                impl->m_frame = frame;
+                if( lod ) {
+                    packedPrim->setViewportLOD( viewportLod );
+                }
+                impl->setPurposes( packedPrim, purposes );
+                impl->resetCaches();
+                impl->m_usdPrim = protoPrims(idx);
+                impl->m_masterPathCacheValid = false;
+                impl->m_transformCache = protoXforms(idx);
+                impl->m_transformCacheValid = true;
+
+                // Equivalent to initializePivot() for PivotLocation::Origin
+                // followed by setTransform().
+                UT_Vector3 pivot;
+                protoXforms(idx).getTranslates(pivot);
+                UT_Matrix4D mx = protoInvXforms(idx);
+                mx *= GusdUT_Gf::Cast(instanceXforms[inst]) * xform;
+
+                packedPrim->setPivot(pivot);
+                packedPrim->setLocalTransform(UT_Matrix3D(mx));
+                packedPrim->setPos3(0, pivot * mx);
+            }
+        });
+    detail.getP()->bumpDataId();
+
+    // The tracker guards its registry with a lock, so register the new prims
+    // serially.
+    if (thePackedUSDTracker)
+    {
+        for( exint i = 0; i < ninstances; ++i )
+        {
+            auto packedPrim = UTverify_cast<GU_PrimPacked *>(
+                detail.getPrimitive(primoff + i));
+            thePackedUSDTracker(packedPrim->sharedImplementation(), true);
+        }
+    }
+
+    return ninstances;
+}
+
 
 /* static */
 GU_PrimPacked* 
@@ -874,6 +1023,8 @@ Gusd_MarkNonTransformingAttribs(GU_Detail &gdp,
         attrib->setNonTransforming(true);
 }
 
+static constexpr UT_StringLit theUsdXformAttrib("usdxform");
+
 /// Record the "usdxform" point attribute with the transform that was applied
 /// to the geometry, so that the inverse transform can be applied when
 /// round-tripping.
@@ -881,7 +1032,6 @@ static void
 Gusd_RecordXformAttrib(GU_Detail &destgdp, const GA_Range &ptrange,
                        const UT_Matrix4D &xform)
 {
-    static constexpr UT_StringLit theUsdXformAttrib("usdxform");
     static constexpr GA_AttributeOwner owner = GA_ATTRIB_POINT;
     static constexpr int tuple_size = UT_Matrix4D::tuple_size;
 
@@ -1086,6 +1236,23 @@ GusdGU_PackedUSD::mergeGeometry(GU_Detail &destgdp,
     }
 }
 
+void
+GusdGU_PackedUSD::transformUnpackedGeometry(GU_Detail &gdp,
+                                            const UT_Matrix4D &transform)
+{
+    // Non-transforming attributes were already marked when the geometry was
+    // unpacked, so they're left alone here just as they would have been.
+    gdp.transform(transform);
+
+    // The usdxform attribute is non-transforming and records the transform
+    // that the geometry was unpacked with.
+    if (gdp.findFloatTuple(GA_ATTRIB_POINT, theUsdXformAttrib.asRef(),
+                           UT_Matrix4D::tuple_size))
+    {
+        Gusd_RecordXformAttrib(gdp, gdp.getPointRange(), transform);
+    }
+}
+
 bool
 GusdGU_PackedUSD::unpackGeometry(
     UT_Array<GU_DetailHandle> &details,
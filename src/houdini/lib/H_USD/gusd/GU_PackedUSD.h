@@ -32,6 +32,8 @@
 
 #include <pxr/pxr.h>
 #include "pxr/usd/usd/prim.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/vt/array.h"
 #include "pxr/usd/usdGeom/imageable.h"
 #include "gusd/purpose.h"
 #include "gusd/stageEdit.h"
@@ -110,6 +112,25 @@ public:
                             const UT_Matrix4D*      xform = nullptr,
                             PivotLocation           pivotloc = PivotLocation::Origin);
 
+    /// Build packed prims for all instances of a point instancer at once.
+    /// Instance \p i refers to the prototype \p protoPaths[protoIndices[i]],
+    /// and has the world transform \p instanceXforms[i] * \p xform.
+    /// Prototypes are resolved once and shared by all of their instances,
+    /// and the per-instance data is filled in parallel. Instances with an
+    /// invalid prototype index are skipped. The pivot is always placed at
+    /// the origin of the prototype. Returns the number of prims built.
+    static exint BuildInstances(
+                            GU_Detail&              detail,
+                            const UT_StringHolder&  fileName,
+                            const SdfPathVector&    protoPaths,
+                            const SdfPath&          srcPrimPath,
+                            const VtArray<int>&     protoIndices,
+                            const VtArray<GfMatrix4d>& instanceXforms,
+                            const UT_Matrix4D&      xform,
+                            UsdTimeCode             frame,
+                            const char*             lod = nullptr,
+                            GusdPurposeSet          purposes = GUSD_PURPOSE_PROXY);
+
     GusdGU_PackedUSD();
     GusdGU_PackedUSD(const GusdGU_PackedUSD &src );
     ~GusdGU_PackedUSD() override;
@@ -288,6 +309,13 @@ public:
     static void mergeGeometry(GU_Detail &destgdp,
                               UT_Array<GU_DetailHandle> &details);
 
+    /// Transforms geometry that was unpacked with an identity transform, so
+    /// that it matches geometry unpacked with @a transform. This allows the
+    /// result of unpacking a prim to be copied for other packed prims that
+    /// reference the same prim with different transforms.
+    static void transformUnpackedGeometry(GU_Detail &gdp,
+                                          const UT_Matrix4D &transform);
+
     const UT_Matrix4D& getUsdTransform() const;
     
 private:
@@ -45,6 +45,7 @@
 #include <GU/GU_Detail.h>
 #include <GU/GU_PrimPacked.h>
 #include <UT/UT_Interrupt.h>
+#include <UT/UT_Map.h>
 #include <UT/UT_ParallelUtil.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -850,6 +851,299 @@ _BuildTypedRangesFromPrimRanges(
 
 } /*namespace*/
 
+namespace
+{
+struct Gusd_ConvertPrims
+{
+    Gusd_ConvertPrims(const GU_Detail &src_gdp,
+                      const UT_String &primvarPattern,
+                      const UT_String &attributePattern,
+                      bool translateSTtoUV,
+                      const UT_StringRef &nonTransformingPrimvarPattern)
+        : mySrcGdp(src_gdp),
+          myPrimvarPattern(primvarPattern),
+          myAttribPattern(attributePattern),
+          myTranslateSTtoUV(translateSTtoUV),
+          myNonTransformingPrimvarPattern(nonTransformingPrimvarPattern)
+    {
+    }
+
+    Gusd_ConvertPrims(const Gusd_ConvertPrims &src, UT_Split)
+        : mySrcGdp(src.mySrcGdp),
+          myPrimvarPattern(src.myPrimvarPattern),
+          myAttribPattern(src.myAttribPattern),
+          myTranslateSTtoUV(src.myTranslateSTtoUV),
+          myNonTransformingPrimvarPattern(src.myNonTransformingPrimvarPattern),
+          mySharedStart(src.mySharedStart),
+          mySharedIndex(src.mySharedIndex),
+          mySharedDetails(src.mySharedDetails)
+    {
+    }
+
+    void operator()(const UT_BlockedRange<exint> &range)
+    {
+        UT_Interrupt *boss = UTgetInterrupt();
+        for (exint i = range.begin(); i != range.end(); ++i)
+        {
+            if (boss->opInterrupt())
+                return;
+
+            const GA_Offset offset = mySrcGdp.primitiveOffset(GA_Index(i));
+
+            const GEO_Primitive* p = mySrcGdp.getGEOPrimitive(offset);
+            if (p->getTypeId() != GusdGU_PackedUSD::typeId())
+                continue;
+
+            auto pp = UTverify_cast<const GU_PrimPacked*>(p);
+            auto prim =
+                UTverify_cast<const GusdGU_PackedUSD*>(pp->sharedImplementation());
+
+            UT_Matrix4D xform;
+            pp->getFullTransform4(xform);
+
+            const exint start = myDetails.entries();
+
+            // Copy the geometry of prims that were already unpacked for
+            // another packed prim, and move it to this prim's transform.
+            const exint shared_i = i - mySharedStart;
+            const exint shared = (mySharedIndex &&
+                                  shared_i < mySharedIndex->entries()) ?
+                (*mySharedIndex)(shared_i) : -1;
+            if (shared >= 0)
+            {
+                for (const GU_DetailHandle &src : (*mySharedDetails)(shared))
+                {
+                    GU_Detail *gdp = new GU_Detail;
+                    gdp->duplicate(*src.gdp());
+                    GusdGU_PackedUSD::transformUnpackedGeometry(*gdp, xform);
+
+                    GU_DetailHandle gdh;
+                    gdh.allocateAndSet(gdp);
+                    myDetails.append(gdh);
+                }
+                myPrimIndices.appendMultiple(
+                    GA_Index(i), myDetails.entries() - start);
+                continue;
+            }
+
+            if (!prim->unpackGeometry(myDetails, &mySrcGdp, pp->getMapOffset(),
+                                      myPrimvarPattern, myAttribPattern,
+                                      myTranslateSTtoUV,
+                                      myNonTransformingPrimvarPattern, xform))
+            {
+                // unpackGeometry() will emit warnings if the prim cannot be
+                // converted back to Houdini geometry, but this is not an
+                // error.
+                continue;
+            }
+
+            myPrimIndices.appendMultiple(
+                GA_Index(i), myDetails.entries() - start);
+        }
+    }
+
+    void join(const Gusd_ConvertPrims &other)
+    {
+        myDetails.concat(other.myDetails);
+        myPrimIndices.concat(other.myPrimIndices);
+    }
+
+    /// Use geometry unpacked by Gusd_UnpackSharedPrims() for the prims
+    /// starting at index @a start.
+    void setShared(exint start,
+                   const UT_Array<exint> &shared_index,
+                   const UT_Array<UT_Array<GU_DetailHandle>> &shared_details)
+    {
+        mySharedStart = start;
+        mySharedIndex = &shared_index;
+        mySharedDetails = &shared_details;
+    }
+
+    const GU_Detail &mySrcGdp;
+    UT_String myPrimvarPattern;
+    UT_String myAttribPattern;
+    bool myTranslateSTtoUV;
+    UT_StringHolder myNonTransformingPrimvarPattern;
+
+    exint mySharedStart = 0;
+    const UT_Array<exint> *mySharedIndex = nullptr;
+    const UT_Array<UT_Array<GU_DetailHandle>> *mySharedDetails = nullptr;
+
+    UT_Array<GU_DetailHandle> myDetails;
+    UT_Array<GA_Index> myPrimIndices;
+};
+
+/// Build the list of source offsets for the details produced by @a convert,
+/// repeating the offset of the source prim for each prim that it expanded
+/// to. @a start is the index of the first intermediate packed prim.
+void
+Gusd_BuildConvertedSrcOffsets(
+    const Gusd_ConvertPrims &convert,
+    GA_Size start,
+    const UT_Array<GusdGU_USD::PrimIndexPair> &primIndexPairs,
+    const GA_OffsetArray &indexToOffset,
+    GA_OffsetList &srcOffsets)
+{
+    const exint n = convert.myDetails.entries();
+
+    GA_Size total = 0;
+    for (exint i = 0; i < n; ++i)
+        total += convert.myDetails[i].gdp()->getNumPrimitives();
+
+    srcOffsets.setEntries(total);
+    GA_Size idx = 0;
+    for (exint i = 0; i < n; ++i)
+    {
+        const GA_Index dst_idx = convert.myPrimIndices[i];
+        const GA_Offset offset =
+            indexToOffset(primIndexPairs(dst_idx - start).second);
+        for (GA_Size j = 0, count =
+                convert.myDetails[i].gdp()->getNumPrimitives(); j < count; ++j)
+        {
+            srcOffsets.set(idx++, offset);
+        }
+    }
+    UT_ASSERT(idx == total);
+}
+
+/// Identifies packed prims whose unpacked geometry only differs by their
+/// transform.
+struct Gusd_UnpackKey
+{
+    bool operator==(const Gusd_UnpackKey &o) const
+    {
+        return prim == o.prim && time == o.time && purposes == o.purposes &&
+               stageId == o.stageId && viewportLOD == o.viewportLOD;
+    }
+
+    struct Hash
+    {
+        size_t operator()(const Gusd_UnpackKey &key) const
+        {
+            size_t h = hash_value(key.prim);
+            SYShashCombine(h, key.time.IsDefault());
+            if (key.time.IsNumeric())
+                SYShashCombine(h, key.time.GetValue());
+            SYShashCombine(h, int(key.purposes));
+            SYShashCombine(h, key.stageId.hash());
+            SYShashCombine(h, key.viewportLOD.hash());
+            return h;
+        }
+    };
+
+    UsdPrim prim;
+    UsdTimeCode time;
+    GusdPurposeSet purposes;
+    UT_StringHolder stageId;
+    UT_StringHolder viewportLOD;
+};
+
+/// Many packed prims commonly reference the same prim with only a different
+/// transform. Each of these prims is unpacked once with an identity transform
+/// into @a shared_details, and @a shared_index records which entry each of
+/// the packed prims (starting at @a start in @a gdp) should copy from, or -1
+/// if it must be unpacked itself.
+bool
+Gusd_UnpackSharedPrims(
+    const Gusd_ConvertPrims &convert,
+    const GU_Detail &gdp,
+    exint start,
+    const UT_Array<UsdPrim> &prims,
+    const GusdDefaultArray<UsdTimeCode> &times,
+    const GusdDefaultArray<GusdPurposeSet> &purposes,
+    const GusdDefaultArray<UT_StringHolder> &stageIds,
+    const GusdDefaultArray<UT_StringHolder> &viewportLODs,
+    UT_Array<exint> &shared_index,
+    UT_Array<UT_Array<GU_DetailHandle>> &shared_details)
+{
+    const exint n = prims.entries();
+
+    // Find the first packed prim with each key, and how many share it.
+    UT_Array<exint> first_index;
+    UT_Array<exint> counts;
+    shared_index.setSizeNoInit(n);
+    {
+        UT_Map<Gusd_UnpackKey, exint, Gusd_UnpackKey::Hash> key_to_index;
+        for (exint i = 0; i < n; ++i)
+        {
+            // Prims inside masters have their transform applied while
+            // refining, so they can't be moved to another transform.
+            if (!prims(i) || prims(i).IsInMaster())
+            {
+                shared_index(i) = -1;
+                continue;
+            }
+
+            Gusd_UnpackKey key{prims(i), times(i), purposes(i), stageIds(i),
+                               viewportLODs(i)};
+            auto it = key_to_index.find(key);
+            if (it == key_to_index.end())
+            {
+                it = key_to_index.emplace(key, first_index.entries()).first;
+                first_index.append(i);
+                counts.append(0);
+            }
+            shared_index(i) = it->second;
+            counts(it->second)++;
+        }
+    }
+
+    // Prims that aren't shared are unpacked directly with their transform.
+    UT_Array<exint> remap;
+    remap.setSizeNoInit(first_index.entries());
+    exint nshared = 0;
+    for (exint i = 0, ni = first_index.entries(); i < ni; ++i)
+    {
+        remap(i) = (counts(i) > 1) ? nshared : -1;
+        if (counts(i) > 1)
+            first_index(nshared++) = first_index(i);
+    }
+    first_index.setSize(nshared);
+    for (exint &idx : shared_index)
+    {
+        if (idx >= 0)
+            idx = remap(idx);
+    }
+
+    if (!nshared)
+        return false;
+
+    UT_Matrix4D identity;
+    identity.identity();
+
+    shared_details.setSize(nshared);
+    UT_Interrupt *boss = UTgetInterrupt();
+    UTparallelForEachNumber(nshared, [&](const UT_BlockedRange<exint> &r)
+    {
+        for (exint i = r.begin(); i != r.end(); ++i)
+        {
+            if (boss->opInterrupt())
+                return;
+
+            const GA_Offset offset =
+                gdp.primitiveOffset(GA_Index(start + first_index(i)));
+            const GEO_Primitive *p = gdp.getGEOPrimitive(offset);
+            if (!p || p->getTypeId() != GusdGU_PackedUSD::typeId())
+                continue;
+
+            auto pp = UTverify_cast<const GU_PrimPacked *>(p);
+            auto prim = UTverify_cast<const GusdGU_PackedUSD *>(
+                pp->sharedImplementation());
+            if (!prim->unpackGeometry(
+                    shared_details(i), &gdp, pp->getMapOffset(),
+                    convert.myPrimvarPattern, convert.myAttribPattern,
+                    convert.myTranslateSTtoUV,
+                    convert.myNonTransformingPrimvarPattern, identity))
+            {
+                shared_details(i).clear();
+            }
+        }
+    });
+
+    return true;
+}
+} // namespace
+
 bool
 GusdGU_USD::AppendExpandedPackedPrims(
     GU_Detail& gd,
@@ -932,47 +1226,26 @@ GusdGU_USD::AppendExpandedPackedPrims(
     if (unpackToPolygons) {
         GA_Size gdStart = gd.getNumPrimitives();
 
-        // If unpacking down to polygons, iterate through the intermediate
-        // packed prims in gdPtr and unpack them into gd.
-        exint i = 0;
-        for (GA_Iterator it(primDstRng); !it.atEnd(); ++it, ++i) {
-            if(task.wasInterrupted()) {
-                return false;
-            }
-
-            const GEO_Primitive* p = gdPtr->getGEOPrimitive(*it);
-            if (p->getTypeId() != GusdGU_PackedUSD::typeId()) {
-                continue;
-            }
-
-            const GU_PrimPacked* pp = UTverify_cast<const GU_PrimPacked*>(p);
-            const GusdGU_PackedUSD* prim =
-                UTverify_cast<const GusdGU_PackedUSD*>(pp->sharedImplementation());
+        // If unpacking down to polygons, convert the intermediate packed
+        // prims in gdPtr to GU_Details in parallel, and then merge them into
+        // gd in a single pass, in the order of the packed prims.
+        Gusd_ConvertPrims convert(*gdPtr, primvarPattern, attributePattern,
+                                  translateSTtoUV,
+                                  nonTransformingPrimvarPattern);
+        UTparallelReduce(
+            UT_BlockedRange<exint>(start, gdPtr->getNumPrimitives()),
+            convert);
 
-            GA_Size gdCurrent = gd.getNumPrimitives();
+        if (task.wasInterrupted()) {
+            delete gdPtr;
+            return false;
+        }
 
-            UT_Matrix4D transform;
-            pp->getFullTransform4(transform);
+        Gusd_BuildConvertedSrcOffsets(convert, start, primIndexPairs,
+                                      indexToOffset, srcOffsets);
 
-            // Unpack this prim.
-            if (!prim->unpackGeometry(
-                    gd, static_cast<const GU_Detail *>(&pp->getDetail()),
-                    pp->getMapOffset(), primvarPattern, attributePattern,
-                    translateSTtoUV, nonTransformingPrimvarPattern, &transform))
-            {
-                // unpackGeometry() will emit warnings if the prim cannot be
-                // converted back to Houdini geometry, but this is not an
-                // error.
-                continue;
-            }
-
-            const GA_Offset offset =
-                indexToOffset(primIndexPairs(i).second);
-            const exint count = gd.getNumPrimitives() - gdCurrent;
-            for (exint j = 0; j < count; ++j) {
-                srcOffsets.append(offset);
-            }
-        }
+        // Merge the details produced from the prims.
+        GusdGU_PackedUSD::mergeGeometry(gd, convert.myDetails);
 
         // primDstRng needs to be reset to be the range of unpacked prims in
         // gd (instead of the range of intermediate packed prims in gdPtr).
@@ -1044,82 +1317,6 @@ GusdGU_USD::AppendExpandedPackedPrims(
     return true;
 }
 
-namespace
-{
-struct Gusd_ConvertPrims
-{
-    Gusd_ConvertPrims(const GU_Detail &src_gdp,
-                      const UT_String &primvarPattern,
-                      const UT_String &attributePattern,
-                      bool translateSTtoUV,
-                      const UT_StringRef &nonTransformingPrimvarPattern)
-        : mySrcGdp(src_gdp),
-          myPrimvarPattern(primvarPattern),
-          myAttribPattern(attributePattern),
-          myTranslateSTtoUV(translateSTtoUV),
-          myNonTransformingPrimvarPattern(nonTransformingPrimvarPattern)
-    {
-    }
-
-    Gusd_ConvertPrims(const Gusd_ConvertPrims &src, UT_Split)
-        : mySrcGdp(src.mySrcGdp),
-          myPrimvarPattern(src.myPrimvarPattern),
-          myAttribPattern(src.myAttribPattern),
-          myTranslateSTtoUV(src.myTranslateSTtoUV),
-          myNonTransformingPrimvarPattern(src.myNonTransformingPrimvarPattern)
-    {
-    }
-
-    void operator()(const UT_BlockedRange<exint> &range)
-    {
-        for (exint i = range.begin(); i != range.end(); ++i)
-        {
-            const GA_Offset offset = mySrcGdp.primitiveOffset(GA_Index(i));
-
-            const GEO_Primitive* p = mySrcGdp.getGEOPrimitive(offset);
-            UT_ASSERT(p->getTypeId() == GusdGU_PackedUSD::typeId());
-
-            auto pp = UTverify_cast<const GU_PrimPacked*>(p);
-            auto prim =
-                UTverify_cast<const GusdGU_PackedUSD*>(pp->sharedImplementation());
-
-            UT_Matrix4D xform;
-            pp->getFullTransform4(xform);
-
-            const exint start = myDetails.entries();
-            if (!prim->unpackGeometry(myDetails, &mySrcGdp, pp->getMapOffset(),
-                                      myPrimvarPattern, myAttribPattern,
-                                      myTranslateSTtoUV,
-                                      myNonTransformingPrimvarPattern, xform))
-            {
-                // unpackGeometry() will emit warnings if the prim cannot be
-                // converted back to Houdini geometry, but this is not an
-                // error.
-                continue;
-            }
-
-            myPrimIndices.appendMultiple(
-                GA_Index(i), myDetails.entries() - start);
-        }
-    }
-
-    void join(const Gusd_ConvertPrims &other)
-    {
-        myDetails.concat(other.myDetails);
-        myPrimIndices.concat(other.myPrimIndices);
-    }
-
-    const GU_Detail &mySrcGdp;
-    UT_String myPrimvarPattern;
-    UT_String myAttribPattern;
-    bool myTranslateSTtoUV;
-    UT_StringHolder myNonTransformingPrimvarPattern;
-
-    UT_Array<GU_DetailHandle> myDetails;
-    UT_Array<GA_Index> myPrimIndices;
-};
-} // namespace
-
 bool
 GusdGU_USD::AppendExpandedPackedPrimsFromLopNode(
     GU_Detail& gd,
@@ -1217,28 +1414,36 @@ GusdGU_USD::AppendExpandedPackedPrimsFromLopNode(
         // If unpacking down to polygons, iterate through the intermediate
         // packed prims in gdPtr, convert them to GU_Details, and merge them
         // into gd.
-        Gusd_ConvertPrims task(*gdPtr, primvarPattern, attributePattern,
-                               translateSTtoUV, nonTransformingPrimvarPattern);
-        UTparallelReduce(
-            UT_BlockedRange<exint>(start, gdPtr->getNumPrimitives()), task);
-
-        // Build the srcOffsets array.
-        for (exint i = 0, n = task.myDetails.entries(); i < n; ++i)
+        Gusd_ConvertPrims convert(*gdPtr, primvarPattern, attributePattern,
+                                  translateSTtoUV,
+                                  nonTransformingPrimvarPattern);
+
+        // Prims that only differ by their transform are unpacked once and
+        // then copied.
+        UT_Array<exint> sharedIndex;
+        UT_Array<UT_Array<GU_DetailHandle>> sharedDetails;
+        if (Gusd_UnpackSharedPrims(convert, *gdPtr, start, prims,
+                                   times, dstPurposes, dstStageIds, dstVpLOD,
+                                   sharedIndex, sharedDetails))
         {
-            const GU_DetailHandle &gdh = task.myDetails[i];
-            GA_Index dst_idx = task.myPrimIndices[i];
+            convert.setShared(start, sharedIndex, sharedDetails);
+        }
 
-            const GA_Offset offset =
-                indexToOffset(primIndexPairs(dst_idx - start).second);
-            for (exint j = 0, count = gdh.gdp()->getNumPrimitives(); j < count;
-                 ++j)
-            {
-                srcOffsets.append(offset);
-            }
+        UTparallelReduce(
+            UT_BlockedRange<exint>(start, gdPtr->getNumPrimitives()),
+            convert);
+
+        if (task.wasInterrupted()) {
+            delete gdPtr;
+            return false;
         }
 
+        // Build the srcOffsets array.
+        Gusd_BuildConvertedSrcOffsets(convert, start, primIndexPairs,
+                                      indexToOffset, srcOffsets);
+
         // Merge the details produced from the prims.
-        GusdGU_PackedUSD::mergeGeometry(gd, task.myDetails);
+        GusdGU_PackedUSD::mergeGeometry(gd, convert.myDetails);
 
         // primDstRng needs to be reset to be the range of unpacked prims in
         // gd (instead of the range of intermediate packed prims in gdPtr).
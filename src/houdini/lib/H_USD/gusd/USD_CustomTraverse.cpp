@@ -28,6 +28,7 @@
 
 #include "gusd/PRM_Shared.h"
 #include "gusd/USD_ThreadedTraverse.h"
+#include "gusd/USD_TraverseCache.h"
 #include "gusd/USD_Utils.h"
 
 #include "pxr/base/arch/hints.h"
@@ -170,13 +171,17 @@ _BadPatternError(const char* type,
 
 void
 _SetPattern(UT_StringMMPattern& patternObj,
+            SYS_HashType& patternHash,
             const char* pattern,
             bool caseSensitive)
 {
     if(!UTisstring(pattern) || UT_String(pattern) == "*") {
         patternObj.clear();
+        patternHash = 0;
     } else {
         patternObj.compile(pattern, caseSensitive);
+        patternHash = UT_StringRef(pattern).hash();
+        SYShashCombine(patternHash, caseSensitive);
     }
 }
             
@@ -244,7 +249,7 @@ void
 GusdUSD_CustomTraverse::Opts::SetNamePattern(
     const char* pattern, bool caseSensitive)
 {
-    _SetPattern(namePattern, pattern, caseSensitive);
+    _SetPattern(namePattern, _namePatternHash, pattern, caseSensitive);
 }
 
 
@@ -252,7 +257,28 @@ void
 GusdUSD_CustomTraverse::Opts::SetPathPattern(
     const char* pattern, bool caseSensitive)
 {
-    _SetPattern(pathPattern, pattern, caseSensitive);
+    _SetPattern(pathPattern, _pathPatternHash, pattern, caseSensitive);
+}
+
+
+bool
+GusdUSD_CustomTraverse::Opts::GetHash(SYS_HashType& hash) const
+{
+    hash = 0;
+    for(TriState state : {active, visible, imageable, defined, abstract,
+                          model, group, instance, master, clips}) {
+        SYShashCombine(hash, int(state));
+    }
+    SYShashCombine(hash, traverseMatched);
+    for(const TfToken& purpose : purposes)
+        SYShashCombine(hash, purpose.Hash());
+    for(const TfToken& kind : kinds)
+        SYShashCombine(hash, kind.Hash());
+    for(const TfType& type : types)
+        SYShashCombine(hash, hash_value(type));
+    SYShashCombine(hash, _namePatternHash);
+    SYShashCombine(hash, _pathPatternHash);
+    return true;
 }
 
 
@@ -481,10 +507,27 @@ GusdUSD_CustomTraverse::FindPrims(const UsdPrim& root,
                                   const GusdUSD_Traverse::Opts* opts) const
 {
     const auto* customOpts = UTverify_cast<const Opts*>(opts);
-    _Visitor visitor(customOpts ? *customOpts : _defaultOpts);
+    const Opts& traverseOpts = customOpts ? *customOpts : _defaultOpts;
+
+    return GusdUSD_TraverseCache::GetInstance().FindPrims(
+        *this, root, time, purposes, skipRoot, &traverseOpts, prims,
+        [&](UT_Array<UsdPrim>& found)
+        {
+            _Visitor visitor(traverseOpts);
+            return GusdUSD_ThreadedTraverse::ParallelFindPrims(
+                root, time, purposes, found, visitor, skipRoot);
+        });
+}
 
-    return GusdUSD_ThreadedTraverse::ParallelFindPrims(
-        root, time, purposes, prims, visitor, skipRoot);
+
+bool
+GusdUSD_CustomTraverse::IsTimeDependent(
+    const GusdUSD_Traverse::Opts* opts) const
+{
+    // Visibility is the only option that depends on the time.
+    const auto* customOpts = UTverify_cast<const Opts*>(opts);
+    const Opts& traverseOpts = customOpts ? *customOpts : _defaultOpts;
+    return traverseOpts.visible != ANY_STATE;
 }
 
 
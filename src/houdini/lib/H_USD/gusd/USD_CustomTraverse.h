@@ -53,6 +53,8 @@ public:
         bool                    Configure(
                                     OP_Parameters& parms, fpreal t) override;
 
+        bool                    GetHash(SYS_HashType& hash) const override;
+
         /** Methods for matching components by wildcard pattern.
             Note that for all methods, an empty pattern is treated
             as equivalent to '*'. I.e., an empty pattern matches everything.
@@ -87,6 +89,11 @@ public:
         UT_Array<TfToken>   purposes, kinds;
         UT_Array<TfType>    types;
         UT_StringMMPattern  namePattern, pathPattern;
+
+    private:
+        /** Hashes of the sources of the name and path patterns,
+            since the compiled patterns can't be hashed.*/
+        SYS_HashType        _namePatternHash = 0, _pathPatternHash = 0;
     };
 
     Opts*           CreateOpts() const override  { return new Opts; }
@@ -107,6 +114,9 @@ public:
                               const GusdUSD_Traverse::Opts* opts=nullptr
                               ) const override;
 
+    bool            IsTimeDependent(const GusdUSD_Traverse::Opts* opts
+                                    ) const override;
+
     static void     Initialize();
 };
 
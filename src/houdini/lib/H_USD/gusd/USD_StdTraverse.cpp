@@ -232,7 +232,8 @@ typedef DefaultImageablePrimVisitorT<
     const GusdUSD_Traverse& name()                      \
     {                                                   \
         static visitor v;                               \
-        static GusdUSD_TraverseSimpleT<visitor> t(v);   \
+        static GusdUSD_TraverseSimpleT<visitor> t(      \
+            v, /*timeDependent*/ false);                \
         return t;                                       \
     }
     
@@ -30,6 +30,7 @@
 #include <UT/UT_ParallelUtil.h>
 #include <UT/UT_Task.h>
 #include <UT/UT_ThreadSpecificValue.h>
+#include <SYS/SYS_Math.h>
 
 #include "gusd/UT_Assert.h"
 #include "gusd/USD_Traverse.h"
@@ -130,8 +131,24 @@ struct TaskData
 };
 
 
+/** Prims are visited serially within a task until the number of prims
+    waiting to be visited reaches this size. The pending prims serve as a
+    lower bound estimate of the size of the remaining subtree, so small
+    subtrees and narrow chains are never split into tasks.*/
+const exint TASK_SPLIT_SIZE = 64;
+
+/** Number of sibling prims handed to each task when the pending prims
+    are split up. This must be smaller than TASK_SPLIT_SIZE so that every
+    task visits at least one prim before splitting again.*/
+const exint TASK_BATCH_SIZE = 32;
+
+
 /** Task for traversing a prim tree in parallel.
 
+    Rather than spawning a task per prim, each task visits a batch of
+    prims, descending serially until enough prims are pending to be worth
+    splitting into batches for child tasks.
+
     See DefaultImageablePrimVisitorT<> for an example of the structure
     expected for visitors. */
 template <class Visitor>
@@ -140,14 +157,31 @@ struct TraverseTaskT : public UT_Task
     TraverseTaskT(const UsdPrim& prim,  exint idx, UsdTimeCode time,
                   GusdPurposeSet purposes,
                   TaskData& data, const Visitor& visitor, bool skipPrim)
-        :  UT_Task(), _prim(prim), _idx(idx), _time(time),
+        :  UT_Task(), _idx(idx), _time(time),
            _purposes(purposes), _data(data),
-           _visited(false), _visitor(visitor), _skipPrim(skipPrim) {}
+           _visited(false), _visitor(visitor), _skipPrim(skipPrim)
+        { _prims.append(prim); }
 
     UT_Task*        run() override;
 
 private:
-    UsdPrim         _prim;
+    TraverseTaskT(UT_Array<UsdPrim>&& prims,  exint idx, UsdTimeCode time,
+                  GusdPurposeSet purposes,
+                  TaskData& data, const Visitor& visitor)
+        :  UT_Task(), _prims(std::move(prims)), _idx(idx), _time(time),
+           _purposes(purposes), _data(data),
+           _visited(false), _visitor(visitor), _skipPrim(false) {}
+
+    void            AppendChildren(const UsdPrim& prim,
+                                   UT_Array<UsdPrim>& pending) const
+                    {
+                        for (const auto& child : prim.GetFilteredChildren(
+                                 _visitor.TraversalPredicate())) {
+                            pending.append(child);
+                        }
+                    }
+
+    UT_Array<UsdPrim> _prims;
     exint           _idx;
     UsdTimeCode     _time;
     GusdPurposeSet  _purposes;
@@ -170,48 +204,69 @@ TraverseTaskT<Visitor>::run()
     if(ARCH_UNLIKELY(_visited)) return NULL;
     _visited = true;
 
-    UT_ASSERT_P(_prim);
+    /* Prims still to be visited. This is used as a stack, since the
+       order of the results is made deterministic when they're gathered.*/
+    UT_Array<UsdPrim> pending;
+    if(_skipPrim) {
+        UT_ASSERT_P(_prims.size() == 1);
+        AppendChildren(_prims(0), pending);
+    } else {
+        pending = std::move(_prims);
+    }
+    _prims.clear();
 
-    if(!_skipPrim) {
+    TaskThreadData* threadData = nullptr;
+    while(pending.size() > 0 && pending.size() < TASK_SPLIT_SIZE) {
+        const UsdPrim prim = pending.last();
+        pending.removeLast();
+        UT_ASSERT_P(prim);
 
         GusdUSD_TraverseControl ctl;
-        if(ARCH_UNLIKELY(_visitor.AcceptPrim(_prim, _time, _purposes, ctl))) {
+        if(ARCH_UNLIKELY(_visitor.AcceptPrim(prim, _time, _purposes, ctl))) {
             /* Matched. Add it to the thread-specific list.*/
-            auto*& threadData = _data.threadData.get();
-            if(!threadData)
-                threadData = new TaskThreadData;
+            if(!threadData) {
+                auto*& tls = _data.threadData.get();
+                if(!tls)
+                    tls = new TaskThreadData;
+                threadData = tls;
+            }
             threadData->prims.append(
-                GusdUSD_Traverse::PrimIndexPair(_prim, _idx));
+                GusdUSD_Traverse::PrimIndexPair(prim, _idx));
         }
-        if(ARCH_UNLIKELY(!ctl.GetVisitChildren())) {
-            return NULL;
+        if(ARCH_LIKELY(ctl.GetVisitChildren())) {
+            AppendChildren(prim, pending);
         }
     }
 
-    /* Count the children so we can increment the ref count accordingly.*/
-    int count = 0;
-    auto children = _prim.GetFilteredChildren(_visitor.TraversalPredicate());
-    for (auto i = children.begin(); i != children.end(); ++i, ++count) {}
-
-    if(count == 0)
+    const exint npending = pending.size();
+    if(npending == 0)
         return NULL;
 
+    /* Enough prims are pending to be worth splitting up.
+       Hand them out to child tasks in batches of siblings.*/
+    const int count = int((npending + TASK_BATCH_SIZE - 1) / TASK_BATCH_SIZE);
+
     setRefCount(count);
     recycleAsContinuation();
 
     const int last = count - 1;
-    int idx = 0;
-    for (const auto& child : 
-          _prim.GetFilteredChildren(_visitor.TraversalPredicate())) {
+    for (int i = 0; i < count; ++i) {
+        const exint start = i*TASK_BATCH_SIZE;
+        const exint end = SYSmin(start + TASK_BATCH_SIZE, npending);
+
+        UT_Array<UsdPrim> batch;
+        batch.setCapacity(end - start);
+        for (exint j = start; j < end; ++j)
+            batch.append(std::move(pending(j)));
+
         auto& task =
-            *new(allocate_child()) TraverseTaskT(child, _idx, _time, 
-                                                 _purposes, _data,
-                                                 _visitor, /*skip prim*/ false);
-        if(idx == last)
+            *new(allocate_child()) TraverseTaskT(std::move(batch), _idx,
+                                                 _time, _purposes, _data,
+                                                 _visitor);
+        if(i == last)
             return &task;
         else
             spawnChild(task);
-        ++idx;
     }
     return NULL;
 }
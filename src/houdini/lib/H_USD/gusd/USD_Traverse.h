@@ -30,6 +30,7 @@
 
 
 #include <PRM/PRM_Name.h>
+#include <SYS/SYS_Hash.h>
 #include <UT/UT_Array.h>
 #include <UT/UT_Error.h>
 #include <UT/UT_NonCopyable.h>
@@ -91,6 +92,11 @@ public:
                               bool skipRoot=true,
                               const Opts* opts=nullptr) const;
 
+    /** Returns true if the prims found by the traversal may change over
+        time. Results of time-independent traversals are cached across
+        all times by GusdUSD_TraverseCache.*/
+    virtual bool    IsTimeDependent(const Opts* opts) const { return true; }
+
     /** Base class that can be derived to provide
         configuration options to the traversal.*/
     struct Opts
@@ -102,6 +108,11 @@ public:
         virtual void    Reset() {}
 
         virtual bool    Configure(OP_Parameters& parms, fpreal t) = 0;
+
+        /** Compute a hash of the options, for caching traversal results.
+            Returns false if the options can't be hashed, in which case
+            the results of traversals using them are not cached.*/
+        virtual bool    GetHash(SYS_HashType& hash) const { return false; }
     };
 
 };
@@ -0,0 +1,305 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "gusd/USD_TraverseCache.h"
+
+#include <SYS/SYS_AtomicInt.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_UniquePtr.h>
+
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/weakBase.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/stage.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+TF_DEFINE_ENV_SETTING(GUSD_TRAVERSECACHE_SIZE, 1000000,
+                      "Maximum number of prims held by the cache of "
+                      "traversal results. Setting this to zero disables "
+                      "caching of traversal results.");
+
+
+namespace {
+
+
+struct _Key
+{
+    SdfPath                 rootPath;
+    const GusdUSD_Traverse* traverse;
+    SYS_HashType            optsHash;
+    UsdTimeCode             time;
+    GusdPurposeSet          purposes;
+    bool                    skipRoot;
+
+    bool    operator==(const _Key& o) const
+            {
+                return rootPath == o.rootPath &&
+                       traverse == o.traverse &&
+                       optsHash == o.optsHash &&
+                       time == o.time &&
+                       purposes == o.purposes &&
+                       skipRoot == o.skipRoot;
+            }
+
+    struct Hash
+    {
+        size_t  operator()(const _Key& k) const
+                {
+                    SYS_HashType h = k.rootPath.GetHash();
+                    SYShashCombine(h, reinterpret_cast<uint64>(k.traverse));
+                    SYShashCombine(h, k.optsHash);
+                    SYShashCombine(h, k.time.IsDefault());
+                    if (k.time.IsNumeric())
+                        SYShashCombine(h, k.time.GetValue());
+                    SYShashCombine(h, int(k.purposes));
+                    SYShashCombine(h, k.skipRoot);
+                    return h;
+                }
+    };
+};
+
+typedef UT_Map<_Key, UT_Array<UsdPrim>, _Key::Hash>  _ResultMap;
+
+
+/* Generations are drawn from a single counter, so that a generation
+   identifies both the stage and the state of its contents.*/
+SYS_AtomicInt64 theGenerationCounter(0);
+
+/* Guards all of the cache state, including the state of each stage.
+   This is never held while calling into USD, other than to copy or
+   release prim handles.*/
+UT_Lock         theLock;
+exint           theNumPrims = 0;
+
+
+/// Results cached for a single stage, which are dropped whenever the
+/// contents of the stage change.
+class _StageRecord : public TfWeakBase // Required for TfNotice
+{
+public:
+    _StageRecord(const UsdStagePtr& stage)
+        : TfWeakBase(), stage(stage), numPrims(0)
+    {
+        generation = theGenerationCounter.add(1);
+        _noticeKey = TfNotice::Register(
+            TfCreateWeakPtr(this),
+            &_StageRecord::_HandleStageDidChange, stage);
+    }
+
+    ~_StageRecord()
+    {
+        TfNotice::Revoke(_noticeKey);
+    }
+
+    /// Drop all results. theLock must be held.
+    void    ClearResults()
+            {
+                theNumPrims -= numPrims;
+                numPrims = 0;
+                results.clear();
+            }
+
+    UsdStagePtr stage;
+    int64       generation;
+    _ResultMap  results;
+    exint       numPrims;
+
+private:
+    void
+    _HandleStageDidChange(const UsdNotice::StageContentsChanged&)
+    {
+        UT_Lock::Scope lock(theLock);
+        generation = theGenerationCounter.add(1);
+        ClearResults();
+    }
+
+    TfNotice::Key   _noticeKey;
+};
+
+typedef UT_UniquePtr<_StageRecord>                      _StageRecordPtr;
+typedef UT_Map<const UsdStage*, _StageRecordPtr>        _StageMap;
+
+_StageMap       theStages;
+
+
+/// Find the record for @a stage. theLock must be held.
+/// Returns null if there is no record for the stage yet.
+_StageRecord*
+_FindRecord(const UsdStagePtr& stage)
+{
+    auto it = theStages.find(get_pointer(stage));
+    if(it == theStages.end() || it->second->stage != stage)
+        return nullptr;
+    return it->second.get();
+}
+
+
+/// Move the records of stages that no longer exist into @a expired, so that
+/// they may be destroyed without holding theLock. theLock must be held.
+void
+_RemoveExpiredRecords(UT_Array<_StageRecordPtr>& expired)
+{
+    for(auto it = theStages.begin(); it != theStages.end(); ) {
+        if(!it->second->stage) {
+            it->second->ClearResults();
+            expired.append(std::move(it->second));
+            it = theStages.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+
+/// Returns the generation of @a stage, creating a record for it if needed.
+int64
+_GetGeneration(const UsdStagePtr& stage)
+{
+    {
+        UT_Lock::Scope lock(theLock);
+        if(_StageRecord* record = _FindRecord(stage))
+            return record->generation;
+    }
+
+    // Registering for notices is done without holding theLock, since
+    // notices may be delivered to other records at the same time.
+    _StageRecordPtr newRecord(new _StageRecord(stage));
+    UT_Array<_StageRecordPtr> expired;
+
+    UT_Lock::Scope lock(theLock);
+    if(_StageRecord* record = _FindRecord(stage)) {
+        // Another thread got here first.
+        expired.append(std::move(newRecord));
+        return record->generation;
+    }
+    _RemoveExpiredRecords(expired);
+
+    const int64 generation = newRecord->generation;
+    theStages[get_pointer(stage)] = std::move(newRecord);
+    return generation;
+}
+
+
+} /*namespace*/
+
+
+GusdUSD_TraverseCache&
+GusdUSD_TraverseCache::GetInstance()
+{
+    static GusdUSD_TraverseCache cache;
+    return cache;
+}
+
+
+bool
+GusdUSD_TraverseCache::FindPrims(const GusdUSD_Traverse& traverse,
+                                 const UsdPrim& root,
+                                 UsdTimeCode time,
+                                 GusdPurposeSet purposes,
+                                 bool skipRoot,
+                                 const GusdUSD_Traverse::Opts* opts,
+                                 UT_Array<UsdPrim>& prims,
+                                 const TraverseFunc& traverseFn)
+{
+    static const exint maxPrims = TfGetEnvSetting(GUSD_TRAVERSECACHE_SIZE);
+
+    SYS_HashType optsHash = 0;
+    const UsdStagePtr stage = root ? root.GetStage() : UsdStagePtr();
+    if(maxPrims <= 0 || !stage || (opts && !opts->GetHash(optsHash)))
+        return traverseFn(prims);
+
+    _Key key;
+    key.rootPath = root.GetPath();
+    key.traverse = &traverse;
+    key.optsHash = optsHash;
+    key.time = traverse.IsTimeDependent(opts) ? time : UsdTimeCode::Default();
+    key.purposes = purposes;
+    key.skipRoot = skipRoot;
+
+    const int64 generation = _GetGeneration(stage);
+    {
+        UT_Lock::Scope lock(theLock);
+        _StageRecord* record = _FindRecord(stage);
+        if(record && record->generation == generation) {
+            auto it = record->results.find(key);
+            if(it != record->results.end()) {
+                prims = it->second;
+                return true;
+            }
+        }
+    }
+
+    if(!traverseFn(prims))
+        return false;
+
+    const exint numPrims = prims.size();
+    if(numPrims > maxPrims)
+        return true;
+
+    UT_Array<_StageRecordPtr> expired;
+    UT_Lock::Scope lock(theLock);
+
+    // Don't cache the results if the stage changed during the traversal.
+    _StageRecord* record = _FindRecord(stage);
+    if(!record || record->generation != generation)
+        return true;
+
+    if(theNumPrims + numPrims > maxPrims) {
+        _RemoveExpiredRecords(expired);
+        if(theNumPrims + numPrims > maxPrims) {
+            for(auto& it : theStages)
+                it.second->ClearResults();
+        }
+    }
+    if(record->results.emplace(key, prims).second) {
+        record->numPrims += numPrims;
+        theNumPrims += numPrims;
+    }
+    return true;
+}
+
+
+void
+GusdUSD_TraverseCache::Clear()
+{
+    _StageMap stages;
+    {
+        UT_Lock::Scope lock(theLock);
+        UTswap(stages, theStages);
+        theNumPrims = 0;
+    }
+}
+
+
+exint
+GusdUSD_TraverseCache::GetNumPrims() const
+{
+    UT_Lock::Scope lock(theLock);
+    return theNumPrims;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
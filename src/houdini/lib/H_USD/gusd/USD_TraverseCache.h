@@ -0,0 +1,95 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+/**
+   \file
+   \brief Cache of USD scene traversal results.
+*/
+#ifndef _GUSD_USD_TRAVERSECACHE_H_
+#define _GUSD_USD_TRAVERSECACHE_H_
+
+
+#include <SYS/SYS_Hash.h>
+#include <UT/UT_Array.h>
+#include <UT/UT_NonCopyable.h>
+
+#include "gusd/api.h"
+#include "gusd/purpose.h"
+#include "gusd/USD_Traverse.h"
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/prim.h"
+
+#include <functional>
+
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/** Cache of the prims found by traversals beneath a root prim.
+
+    Results are keyed on the stage, the root prim, the traversal and its
+    options, the purposes and, for time-dependent traversals, the time.
+    Each stage has a generation that changes whenever the contents of the
+    stage change, which drops all results for that stage. Results of
+    time-independent traversals are reused across all times, so cooking a
+    frame range only pays the cost of traversing once.
+
+    The maximum number of cached prims is set by GUSD_TRAVERSECACHE_SIZE.
+    Setting it to zero disables the cache.*/
+class GusdUSD_TraverseCache : UT_NonCopyable
+{
+public:
+    typedef std::function<bool (UT_Array<UsdPrim>&)>  TraverseFunc;
+
+    GUSD_API
+    static GusdUSD_TraverseCache&   GetInstance();
+
+    /** Return the prims found by @a traverse beneath @a root, either from
+        the cache or by running @a traverseFn and caching its results.
+        Results of traversals that fail, or whose options can't be
+        hashed, are not cached.*/
+    GUSD_API
+    bool    FindPrims(const GusdUSD_Traverse& traverse,
+                      const UsdPrim& root,
+                      UsdTimeCode time,
+                      GusdPurposeSet purposes,
+                      bool skipRoot,
+                      const GusdUSD_Traverse::Opts* opts,
+                      UT_Array<UsdPrim>& prims,
+                      const TraverseFunc& traverseFn);
+
+    /** Drop all cached results.*/
+    GUSD_API
+    void    Clear();
+
+    /** Number of prims held by the cache.*/
+    GUSD_API
+    exint   GetNumPrims() const;
+
+private:
+    GusdUSD_TraverseCache() = default;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif /*_GUSD_USD_TRAVERSECACHE_H_*/
@@ -29,19 +29,26 @@
 #include "gusd/defaultArray.h"
 #include "gusd/USD_Traverse.h"
 #include "gusd/USD_ThreadedTraverse.h"
+#include "gusd/USD_TraverseCache.h"
 
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 /** Templated class for declaring simple, threaded traversals.
     See GusdUSD_ThreadedTraverse::VisiblePrimVisitorT for an
-    example of the structure expected for visitors.*/
+    example of the structure expected for visitors.
+
+    Traversals whose visitors don't depend on the time should be declared
+    with @a timeDependent disabled, so their results can be cached across
+    all times.*/
 template <class Visitor>
 class GusdUSD_TraverseSimpleT : public GusdUSD_Traverse
 {
 public:
-    GusdUSD_TraverseSimpleT(const Visitor& visitor)
-        : GusdUSD_Traverse(), _visitor(visitor) {}
+    GusdUSD_TraverseSimpleT(const Visitor& visitor,
+                            bool timeDependent=true)
+        : GusdUSD_Traverse(), _visitor(visitor),
+          _timeDependent(timeDependent) {}
 
     ~GusdUSD_TraverseSimpleT() override {}
 
@@ -59,8 +66,12 @@ public:
                       bool skipRoot=true,
                       const Opts* opts=NULL) const override;
 
+    bool    IsTimeDependent(const Opts* opts) const override
+            { return _timeDependent; }
+
 private:
     const Visitor&  _visitor;
+    const bool      _timeDependent;
 };
 
 
@@ -73,8 +84,13 @@ GusdUSD_TraverseSimpleT<Visitor>::FindPrims(const UsdPrim& root,
                                             bool skipRoot,
                                             const Opts* opts) const
 {
-    return GusdUSD_ThreadedTraverse::ParallelFindPrims(
-        root, time, purposes, prims, _visitor, skipRoot);
+    return GusdUSD_TraverseCache::GetInstance().FindPrims(
+        *this, root, time, purposes, skipRoot, opts, prims,
+        [&](UT_Array<UsdPrim>& found)
+        {
+            return GusdUSD_ThreadedTraverse::ParallelFindPrims(
+                root, time, purposes, found, _visitor, skipRoot);
+        });
 }
 
 
@@ -0,0 +1,466 @@
+/*
+ * Copyright 2019 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+// CPU-only benchmark of the gusd caches and wrappers that dominate the cost
+// of unpacking packed USD at scale. It generates a synthetic stage with a
+// deep, time-sampled transform hierarchy, many meshes, and many instances of
+// a shared prototype, and then times each of these paths at a range of
+// thread counts:
+//
+//  - GusdStageCacheReader::FindOrOpen and GetPrim
+//  - GusdUSD_XformCache::GetLocalToWorldTransforms
+//  - GusdBoundsCache::ComputeWorldBound
+//  - GusdMeshWrapper::refine
+//  - GusdGU_USD::ComputeTransformsFromAttrs
+//
+// Usage: gusd_benchmark [-d depth] [-b branching] [-i instances]
+//                       [-f frames] [-t max_threads] [-o stage.usda]
+
+#include "gusd/boundsCache.h"
+#include "gusd/GU_USD.h"
+#include "gusd/meshWrapper.h"
+#include "gusd/purpose.h"
+#include "gusd/stageCache.h"
+#include "gusd/USD_XformCache.h"
+
+#include <GA/GA_Handle.h>
+#include <GT/GT_Refine.h>
+#include <GU/GU_Detail.h>
+#include <SYS/SYS_AtomicInt.h>
+#include <UT/UT_Array.h>
+#include <UT/UT_BoundingBox.h>
+#include <UT/UT_Matrix4.h>
+#include <UT/UT_ParallelUtil.h>
+#include <UT/UT_StopWatch.h>
+#include <UT/UT_String.h>
+#include <UT/UT_Thread.h>
+#include <UT/UT_WorkBuffer.h>
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/xform.h>
+
+#include <tbb/task_arena.h>
+
+#include <functional>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+
+struct BenchParms
+{
+    int                  myDepth = 6;
+    int                  myBranching = 4;
+    int                  myInstances = 10000;
+    int                  myFrames = 24;
+    int                  myMaxThreads = 0;
+    UT_StringHolder      myOutput;
+};
+
+// A refiner that only counts the primitives it is given, so the benchmark
+// measures the wrapper rather than what is done with the refined geometry.
+class CountingRefiner : public GT_Refine
+{
+public:
+    void addPrimitive(const GT_PrimitiveHandle &prim) override
+    {
+        if (prim)
+            myCount.add(1);
+    }
+
+    SYS_AtomicInt32      myCount;
+};
+
+// Peak resident set size of the process in megabytes, or -1 if unknown.
+fpreal
+peakMemoryMB()
+{
+#if !defined(_WIN32)
+    struct rusage        usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined(__APPLE__)
+        return fpreal(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+        return fpreal(usage.ru_maxrss) / 1024.0;
+#endif
+    }
+#endif
+    return -1;
+}
+
+void
+usage(const char *program)
+{
+    std::cerr << "Usage: " << program
+              << " [-d depth] [-b branching] [-i instances]"
+              << " [-f frames] [-t max_threads] [-o stage.usda]\n";
+}
+
+bool
+parseArgs(int argc, char *argv[], BenchParms &parms)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i + 1 >= argc)
+            return false;
+        if (!strcmp(argv[i], "-d"))
+            parms.myDepth = SYSmax(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "-b"))
+            parms.myBranching = SYSmax(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "-i"))
+            parms.myInstances = SYSmax(atoi(argv[++i]), 0);
+        else if (!strcmp(argv[i], "-f"))
+            parms.myFrames = SYSmax(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "-t"))
+            parms.myMaxThreads = SYSmax(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "-o"))
+            parms.myOutput = argv[++i];
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Author a unit cube mesh under the given path.
+void
+defineCube(const UsdStageRefPtr &stage, const SdfPath &path)
+{
+    static const GfVec3f thePoints[] = {
+        GfVec3f(-1, -1, -1), GfVec3f(1, -1, -1),
+        GfVec3f(1, 1, -1), GfVec3f(-1, 1, -1),
+        GfVec3f(-1, -1, 1), GfVec3f(1, -1, 1),
+        GfVec3f(1, 1, 1), GfVec3f(-1, 1, 1)
+    };
+    static const int theIndices[] = {
+        0, 3, 2, 1,  4, 5, 6, 7,  0, 1, 5, 4,
+        1, 2, 6, 5,  2, 3, 7, 6,  3, 0, 4, 7
+    };
+    UsdGeomMesh          mesh = UsdGeomMesh::Define(stage, path);
+
+    mesh.CreatePointsAttr(VtValue(VtVec3fArray(
+        std::begin(thePoints), std::end(thePoints))));
+    mesh.CreateFaceVertexCountsAttr(VtValue(VtIntArray(6, 4)));
+    mesh.CreateFaceVertexIndicesAttr(VtValue(VtIntArray(
+        std::begin(theIndices), std::end(theIndices))));
+    mesh.CreateSubdivisionSchemeAttr(VtValue(UsdGeomTokens->none));
+}
+
+// Build a tree of time-sampled transforms with a mesh at every leaf, and a
+// flat list of instances referencing a single prototype.
+void
+defineHierarchy(const UsdStageRefPtr &stage, const SdfPath &path,
+        int depth, const BenchParms &parms)
+{
+    UsdGeomXform         xform = UsdGeomXform::Define(stage, path);
+    UsdGeomXformOp       translate = xform.AddTranslateOp();
+
+    for (int f = 0; f < parms.myFrames; ++f)
+        translate.Set(GfVec3d(f * 0.1, depth, 0), UsdTimeCode(f + 1));
+
+    if (depth >= parms.myDepth)
+    {
+        defineCube(stage, path.AppendChild(TfToken("mesh")));
+        return;
+    }
+
+    for (int i = 0; i < parms.myBranching; ++i)
+    {
+        UT_WorkBuffer    name;
+
+        name.sprintf("node%d", i);
+        defineHierarchy(stage, path.AppendChild(TfToken(name.buffer())),
+            depth + 1, parms);
+    }
+}
+
+UsdStageRefPtr
+buildStage(const std::string &path, const BenchParms &parms)
+{
+    UsdStageRefPtr       stage = UsdStage::CreateNew(path);
+
+    if (!stage)
+        return stage;
+
+    stage->SetStartTimeCode(1);
+    stage->SetEndTimeCode(parms.myFrames);
+    defineHierarchy(stage, SdfPath("/World"), 1, parms);
+
+    SdfPath              protopath("/Prototypes/proto");
+    SdfPath              instroot("/Instances");
+
+    UsdGeomXform::Define(stage, protopath.GetParentPath());
+    UsdGeomXform::Define(stage, protopath);
+    defineCube(stage, protopath.AppendChild(TfToken("cube")));
+    UsdGeomXform::Define(stage, instroot);
+    for (int i = 0; i < parms.myInstances; ++i)
+    {
+        UT_WorkBuffer    name;
+
+        name.sprintf("inst%d", i);
+
+        UsdGeomXform     inst = UsdGeomXform::Define(stage,
+                                    instroot.AppendChild(
+                                        TfToken(name.buffer())));
+
+        inst.AddTranslateOp().Set(GfVec3d(i % 100, i / 100, 0));
+        inst.GetPrim().GetReferences().AddInternalReference(protopath);
+        inst.GetPrim().SetInstanceable(true);
+    }
+
+    stage->GetRootLayer()->Save();
+    return stage;
+}
+
+// Run a benchmark once for each thread count, printing the time taken and
+// the number of items processed per second.
+void
+runBenchmark(const char *name, const UT_IntArray &threadcounts, exint nitems,
+        const std::function<void()> &clear,
+        const std::function<void()> &body)
+{
+    for (int nthreads : threadcounts)
+    {
+        tbb::task_arena  arena(nthreads);
+        UT_StopWatch     timer;
+        fpreal           seconds;
+
+        if (clear)
+            clear();
+
+        timer.start();
+        arena.execute(body);
+        seconds = timer.lap();
+
+        printf("%-32s threads %3d  %10.4f s  %14.1f items/s  peak %9.1f MB\n",
+            name, nthreads, seconds,
+            seconds > 0 ? nitems / seconds : 0.0, peakMemoryMB());
+        fflush(stdout);
+    }
+}
+
+} // end namespace
+
+int
+main(int argc, char *argv[])
+{
+    BenchParms           parms;
+
+    if (!parseArgs(argc, argv, parms))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::string          stagepath(parms.myOutput.toStdString());
+
+    if (stagepath.empty())
+        stagepath = ArchMakeTmpFileName("gusd_benchmark", ".usda");
+
+    UT_StopWatch         buildtimer;
+
+    buildtimer.start();
+    if (!buildStage(stagepath, parms))
+    {
+        std::cerr << "Unable to create stage " << stagepath << "\n";
+        return 1;
+    }
+    printf("Built %s in %.4f s\n", stagepath.c_str(), buildtimer.lap());
+
+    UT_IntArray          threadcounts;
+    int                  maxthreads = parms.myMaxThreads > 0
+                                ? parms.myMaxThreads
+                                : UT_Thread::getNumProcessors();
+
+    for (int n = 1; n < maxthreads; n *= 2)
+        threadcounts.append(n);
+    threadcounts.append(maxthreads);
+
+    GusdStageCache      &cache = GusdStageCache::GetInstance();
+    UT_StringHolder      stagename(stagepath);
+    UsdStageRefPtr       stage;
+
+    runBenchmark("StageCache FindOrOpen (cold)", threadcounts, 1,
+        [&]() { GusdStageCacheWriter(cache).Clear(); },
+        [&]() { stage = GusdStageCacheReader(cache).FindOrOpen(stagename); });
+    if (!stage)
+    {
+        std::cerr << "Unable to open stage " << stagepath << "\n";
+        return 1;
+    }
+
+    // Gather the prims the other benchmarks operate on.
+    UT_Array<UsdPrim>    xformprims;
+    UT_Array<UsdPrim>    meshprims;
+    UT_Array<SdfPath>    primpaths;
+
+    for (const UsdPrim &prim : stage->Traverse())
+    {
+        primpaths.append(prim.GetPath());
+        if (prim.IsA<UsdGeomMesh>())
+            meshprims.append(prim);
+        if (prim.IsA<UsdGeomXformable>())
+            xformprims.append(prim);
+    }
+    for (const UsdPrim &prim :
+         UsdPrimRange(stage->GetPrimAtPath(SdfPath("/Instances")),
+             UsdTraverseInstanceProxies()))
+    {
+        if (prim.IsA<UsdGeomMesh>())
+            meshprims.append(prim);
+    }
+    printf("%d transforms, %d meshes, %d prim paths\n",
+        int(xformprims.size()), int(meshprims.size()),
+        int(primpaths.size()));
+
+    runBenchmark("StageCache GetPrim", threadcounts, primpaths.size(),
+        nullptr,
+        [&]()
+        {
+            UTparallelForLightItems(UT_BlockedRange<exint>(
+                0, primpaths.size()),
+                [&](const UT_BlockedRange<exint> &r)
+                {
+                    GusdStageCacheReader reader(cache);
+
+                    for (exint i = r.begin(); i < r.end(); ++i)
+                        reader.GetPrim(stagename, primpaths(i));
+                });
+        });
+
+    UT_Array<UT_Matrix4D> xforms;
+
+    xforms.setSizeNoInit(xformprims.size());
+    for (int f = 1; f <= parms.myFrames; f += SYSmax(parms.myFrames / 4, 1))
+    {
+        UT_WorkBuffer    name;
+
+        name.sprintf("XformCache world frame %d", f);
+        runBenchmark(name.buffer(), threadcounts, xformprims.size(),
+            [&]() { GusdUSD_XformCache::GetInstance().Clear(); },
+            [&]()
+            {
+                GusdUSD_XformCache::GetInstance().GetLocalToWorldTransforms(
+                    xformprims,
+                    GusdDefaultArray<UsdTimeCode>(UsdTimeCode(f)),
+                    xforms.data());
+            });
+    }
+    runBenchmark("XformCache world (warm)", threadcounts, xformprims.size(),
+        nullptr,
+        [&]()
+        {
+            GusdUSD_XformCache::GetInstance().GetLocalToWorldTransforms(
+                xformprims, GusdDefaultArray<UsdTimeCode>(UsdTimeCode(1)),
+                xforms.data());
+        });
+
+    TfTokenVector        purposes({ UsdGeomTokens->default_ });
+
+    runBenchmark("BoundsCache world bounds", threadcounts, meshprims.size(),
+        [&]() { GusdBoundsCache::GetInstance().Clear(); },
+        [&]()
+        {
+            UTparallelForLightItems(UT_BlockedRange<exint>(
+                0, meshprims.size()),
+                [&](const UT_BlockedRange<exint> &r)
+                {
+                    UT_BoundingBox   box;
+
+                    for (exint i = r.begin(); i < r.end(); ++i)
+                        GusdBoundsCache::GetInstance().ComputeWorldBound(
+                            meshprims(i), UsdTimeCode(1), purposes, box);
+                });
+        });
+
+    CountingRefiner      refiner;
+
+    runBenchmark("MeshWrapper refine", threadcounts, meshprims.size(),
+        [&]() { refiner.myCount.relaxedStore(0); },
+        [&]()
+        {
+            UTparallelFor(UT_BlockedRange<exint>(0, meshprims.size()),
+                [&](const UT_BlockedRange<exint> &r)
+                {
+                    for (exint i = r.begin(); i < r.end(); ++i)
+                    {
+                        GusdMeshWrapper mesh(UsdGeomMesh(meshprims(i)),
+                            UsdTimeCode(1), GUSD_PURPOSE_DEFAULT);
+
+                        mesh.refine(refiner);
+                    }
+                });
+        });
+
+    // Transforms from instancing attributes, as done when unpacking points.
+    GU_Detail            gdp;
+    GA_Offset            start = gdp.appendPointBlock(
+                                    SYSmax(parms.myInstances, 1));
+    GA_RWHandleQ         orient(gdp.addFloatTuple(GA_ATTRIB_POINT,
+                                    "orient", 4));
+    GA_RWHandleF         pscale(gdp.addFloatTuple(GA_ATTRIB_POINT,
+                                    "pscale", 1));
+    GA_OffsetArray       offsets;
+
+    for (exint i = 0, n = gdp.getNumPoints(); i < n; ++i)
+    {
+        GA_Offset        pt = start + i;
+
+        gdp.setPos3(pt, UT_Vector3(i % 100, i / 100, 0));
+        orient.set(pt, UT_QuaternionF(0.1f * (i % 31), UT_Vector3F(0, 1, 0)));
+        pscale.set(pt, 1.0f + 0.01f * (i % 7));
+        offsets.append(pt);
+    }
+
+    UT_Array<UT_Matrix4D> ptxforms;
+
+    ptxforms.setSizeNoInit(offsets.size());
+    runBenchmark("GU_USD ComputeTransformsFromAttrs", threadcounts,
+        offsets.size(), nullptr,
+        [&]()
+        {
+            GusdGU_USD::ComputeTransformsFromAttrs(gdp, GA_ATTRIB_POINT,
+                offsets, ptxforms.data());
+        });
+
+    if (!parms.myOutput.isstring())
+        ArchUnlinkFile(stagepath.c_str());
+
+    return 0;
+}
@@ -1557,20 +1557,9 @@ GusdInstancerWrapper::unpack(UT_Array<GU_DetailHandle> &details,
     GU_DetailHandle gdh;
     gdh.allocateAndSet(detail);
 
-    for( size_t i = 0; i < indices.size(); ++i )
-    {
-        const int idx = indices[i];
-        if( idx < 0 || idx >= targets.size() )
-        {
-            TF_WARN( "Invalid prototype index: %d", idx );
-            continue;
-        }
-
-        const UT_Matrix4D m = GusdUT_Gf::Cast(frames[i]) * xform;
-        GusdGU_PackedUSD::Build(
-                *detail, fileName, targets[idx], primPath, i, frame,
-                viewportLod, purposes, UsdPrim(), &m);
-    }
+    GusdGU_PackedUSD::BuildInstances(
+            *detail, fileName, targets, primPath, indices, frames, xform,
+            frame, viewportLod, purposes);
 
 
     // unpack primvars to point attributes.